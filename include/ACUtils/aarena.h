@@ -0,0 +1,43 @@
+#ifndef ACUTILS_AARENA_H
+#define ACUTILS_AARENA_H
+
+#include "macros.h"
+#include "types.h"
+
+ACUTILS_OPEN_EXTERN_C
+
+struct AArena;
+
+/**
+ * A position in an arena returned by AArena_mark. Rewinding to it releases everything allocated after the mark.
+ */
+struct AArenaMark
+{
+    void *block;
+    size_t used;
+};
+
+ACUTILS_HD_FUNC struct AArena* AArena_construct(void);
+ACUTILS_HD_FUNC struct AArena* AArena_constructWithBlockSize(size_t blockSize);
+ACUTILS_HD_FUNC struct AArena* AArena_constructWithBlockSizeAndAllocator(size_t blockSize, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC void AArena_destruct(struct AArena *arena);
+
+ACUTILS_HD_FUNC struct ACUtilsAllocator AArena_allocator(struct AArena *arena);
+
+ACUTILS_HD_FUNC void* AArena_allocate(struct AArena *arena, size_t size);
+ACUTILS_HD_FUNC void* AArena_reallocate(struct AArena *arena, void *ptr, size_t size);
+ACUTILS_HD_FUNC void AArena_deallocate(struct AArena *arena, void *ptr);
+
+ACUTILS_HD_FUNC size_t AArena_usedSize(const struct AArena *arena);
+
+ACUTILS_HD_FUNC struct AArenaMark AArena_mark(const struct AArena *arena);
+ACUTILS_HD_FUNC void AArena_rewind(struct AArena *arena, struct AArenaMark mark);
+ACUTILS_HD_FUNC void AArena_clear(struct AArena *arena);
+
+#ifdef ACUTILS_ONE_SOURCE
+#   include "../../src/aarena.c"
+#endif
+
+ACUTILS_CLOSE_EXTERN_C
+
+#endif /* ACUTILS_AARENA_H */
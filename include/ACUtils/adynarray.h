@@ -6,18 +6,40 @@
 
 ACUTILS_OPEN_EXTERN_C
 
+#define private_ACUtils_ADynArray_members(type) \
+    const ACUtilsReallocator reallocator; \
+    const ACUtilsDeallocator deallocator; \
+    ACUtilsGrowStrategy growStrategy; \
+    size_t size; \
+    size_t capacity; \
+    type* buffer; \
+    struct ACUtilsAllocator allocator; \
+    unsigned int flags; \
+    unsigned int shrinkDivisor; \
+    size_t alignment; \
+    void *tombstones;
+
 /**
  * Creates the struct declaration for an dynamic array.
  */
 #define A_DYNAMIC_ARRAY_DEFINITION(name, type) \
     struct name \
     { \
-        const ACUtilsReallocator reallocator; \
-        const ACUtilsDeallocator deallocator; \
-        ACUtilsGrowStrategy growStrategy; \
-        size_t size; \
-        size_t capacity; \
-        type* buffer; \
+        private_ACUtils_ADynArray_members(type) \
+    }
+/**
+ * Creates the struct declaration for an dynamic array with room for inlineCapacity elements inside the struct.
+ * Arrays of this type must be constructed with ADynArray_constructSmall (or its allocator variants), they use the inline
+ * elements until they hold more than inlineCapacity elements and only then allocate a buffer with the reallocator.
+ * All other ADynArray macros can be used as with arrays defined by A_DYNAMIC_ARRAY_DEFINITION.
+ */
+#define A_SMALL_DYNAMIC_ARRAY_DEFINITION(name, type, inlineCapacity) \
+    struct name \
+    { \
+        private_ACUtils_ADynArray_members(type) \
+        size_t smallCapacity; \
+        size_t smallOffset; \
+        type smallBuffer[inlineCapacity]; \
     }
 
 /**
@@ -41,6 +63,123 @@ ACUTILS_OPEN_EXTERN_C
  */
 #define ADynArray_constructWithAllocator(ArrayType, reallocator, deallocator) \
     ((ArrayType*) private_ACUtils_ADynArray_constructWithAllocator(sizeof(*((ArrayType*) 0)->buffer), reallocator, deallocator))
+/**
+ * Constructs a dynamic array of the passed type and initializes it with size 0.
+ * The passed dynamic array type must be defined with A_DYNAMIC_ARRAY_DEFINITION(name, type) and the passed allocator
+ * must have a valid reallocator and deallocator!
+ * The allocator object is copied into the dynamic array, its context must stay valid until the array is destructed.
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param allocator A pointer to the allocator object to allocate and free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructWithAllocatorObject(ArrayType, allocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructWithAllocatorObject(sizeof(*((ArrayType*) 0)->buffer), allocator))
+/**
+ * Constructs a dynamic array of the passed type and initializes it with size 0.
+ * The struct of the array and its initial buffer are placed in one single allocation. The buffer is moved to its own
+ * allocation as soon as it has to grow, this saves one allocation and one deallocation for arrays which never grow
+ * beyond the initial capacity and keeps the elements of small arrays next to the struct in memory.
+ * The passed dynamic array type must be defined with A_DYNAMIC_ARRAY_DEFINITION(name, type).
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructCompact(ArrayType) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructCompact(sizeof(*((ArrayType*) 0)->buffer)))
+/**
+ * Same as ADynArray_constructCompact but allocates with the passed reallocator and deallocator, which must be not null!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param reallocator The function to reallocate memory with. This must be not null!
+ * @param deallocator The function to free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructCompactWithAllocator(ArrayType, reallocator, deallocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructCompactWithAllocator(sizeof(*((ArrayType*) 0)->buffer), reallocator, deallocator))
+/**
+ * Same as ADynArray_constructCompact but allocates with the passed allocator object, which must have a valid
+ * reallocator and deallocator!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param allocator A pointer to the allocator object to allocate and free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructCompactWithAllocatorObject(ArrayType, allocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructCompactWithAllocatorObject(sizeof(*((ArrayType*) 0)->buffer), allocator))
+#define private_ACUtils_ADynArray_smallLayout(ArrayType) \
+    sizeof(*((ArrayType*) 0)->buffer), sizeof(ArrayType), offsetof(ArrayType, smallBuffer), \
+    sizeof(((ArrayType*) 0)->smallBuffer) / sizeof(*((ArrayType*) 0)->buffer)
+/**
+ * Constructs a dynamic array of the passed type and initializes it with size 0.
+ * The elements are stored inside the struct as long as they fit into its inline capacity, a buffer is only allocated
+ * if the array grows beyond it. ADynArray_shrinkToFit moves the elements back inside the struct if they fit again.
+ * The passed dynamic array type must be defined with A_SMALL_DYNAMIC_ARRAY_DEFINITION(name, type, inlineCapacity).
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructSmall(ArrayType) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructSmall(private_ACUtils_ADynArray_smallLayout(ArrayType)))
+/**
+ * Same as ADynArray_constructSmall but allocates with the passed reallocator and deallocator, which must be not null!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param reallocator The function to reallocate memory with. This must be not null!
+ * @param deallocator The function to free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructSmallWithAllocator(ArrayType, reallocator, deallocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructSmallWithAllocator(private_ACUtils_ADynArray_smallLayout(ArrayType), \
+                                                                        reallocator, deallocator))
+/**
+ * Same as ADynArray_constructSmall but allocates with the passed allocator object, which must have a valid
+ * reallocator and deallocator!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param allocator A pointer to the allocator object to allocate and free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructSmallWithAllocatorObject(ArrayType, allocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructSmallWithAllocatorObject(private_ACUtils_ADynArray_smallLayout(ArrayType), \
+                                                                              allocator))
+/**
+ * Constructs a dynamic array of the passed type and initializes it with size 0.
+ * The buffer of the array is aligned to alignment bytes (e.g. 16, 32 or 64 for aligned SIMD loads or to start at a
+ * cache line) and stays aligned whenever it is reallocated by reserve, shrinkToFit or the shrink policy. Alignments
+ * above the alignment of the allocator cost alignment bytes of extra memory per buffer.
+ * The passed dynamic array type must be defined with A_DYNAMIC_ARRAY_DEFINITION(name, type).
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param alignment The alignment of the buffer in bytes. This must be a power of two and at most 128!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructAligned(ArrayType, alignment) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructAligned(sizeof(*((ArrayType*) 0)->buffer), alignment))
+/**
+ * Same as ADynArray_constructAligned but allocates with the passed reallocator and deallocator, which must be not null!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param alignment The alignment of the buffer in bytes. This must be a power of two and at most 128!
+ * @param reallocator The function to reallocate memory with. This must be not null!
+ * @param deallocator The function to free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructAlignedWithAllocator(ArrayType, alignment, reallocator, deallocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructAlignedWithAllocator(sizeof(*((ArrayType*) 0)->buffer), alignment, \
+                                                                          reallocator, deallocator))
+/**
+ * Same as ADynArray_constructAligned but allocates with the passed allocator object, which must have a valid
+ * reallocator and deallocator!
+ *
+ * @param ArrayType The type of the dynamic array to construct.
+ * @param alignment The alignment of the buffer in bytes. This must be a power of two and at most 128!
+ * @param allocator A pointer to the allocator object to allocate and free memory with. This must be not null!
+ * @return A Pointer to the constructed Array or null on failure.
+ */
+#define ADynArray_constructAlignedWithAllocatorObject(ArrayType, alignment, allocator) \
+    ((ArrayType*) private_ACUtils_ADynArray_constructAlignedWithAllocatorObject(sizeof(*((ArrayType*) 0)->buffer), \
+                                                                                alignment, allocator))
 /**
  * Destructs the dynamic array and releases all held resources.
  *
@@ -61,6 +200,12 @@ ACUTILS_OPEN_EXTERN_C
  */
 #define ADynArray_deallocator(dynArray) \
     (((dynArray) == nullptr) ? nullptr : (dynArray)->deallocator)
+/**
+ * @param dynArray The dynamic array to get the allocator object from.
+ * @return A pointer to the allocator object of dynArray or null if dynArray was constructed without an allocator object.
+ */
+#define ADynArray_allocator(dynArray) \
+    (((dynArray) == nullptr || (dynArray)->allocator.reallocator == nullptr) ? nullptr : &(dynArray)->allocator)
 /**
  * @param dynArray The dynamic array to get the grow strategy from.
  * @return The grow strategy of dynArray.
@@ -73,13 +218,47 @@ ACUTILS_OPEN_EXTERN_C
  */
 #define ADynArray_setGrowStrategy(dynArray, growStrategy) \
     (private_ACUtils_ADynArray_setGrowStrategy(dynArray, growStrategy))
+/**
+ * @param dynArray The dynamic array to get the shrink policy from.
+ * @return The shrink divisor of dynArray (0 if capacity is only released by ADynArray_shrinkToFit).
+ */
+#define ADynArray_shrinkPolicy(dynArray) \
+    (((dynArray) == nullptr) ? 0 : (dynArray)->shrinkDivisor)
+/**
+ * Sets the shrink policy of dynArray. If shrinkDivisor is at least 2, ADynArray_remove and ADynArray_clear release
+ * capacity once the size drops below capacity / shrinkDivisor. The buffer is then reallocated to what the grow strategy
+ * returns for twice the size, so the array has to double its size before it grows again and to drop below
+ * 1 / shrinkDivisor of the new capacity before it shrinks again. This keeps workloads which oscillate around a size
+ * from reallocating over and over. A shrinkDivisor of 0 or 1 disables the policy (the default).
+ * Arrays without a grow strategy and compact arrays whose buffer is still inside the struct are never shrunk.
+ *
+ * @param dynArray The dynamic array to set the shrink policy for.
+ * @param shrinkDivisor Capacity is released if the size drops below capacity / shrinkDivisor.
+ */
+#define ADynArray_setShrinkPolicy(dynArray, shrinkDivisor) \
+    private_ACUtils_ADynArray_setShrinkPolicy(dynArray, shrinkDivisor)
+/**
+ * Enables or disables reclaiming of allocator slack for dynArray. If enabled, the capacity is set to the number of
+ * elements that really fit into the buffer whenever it is reallocated, which may be more than the grow strategy
+ * returned (and even more than its maximum capacity). The size is queried with the usableSize function of the allocator
+ * object or with malloc_usable_size if the array uses realloc with glibc, otherwise nothing changes.
+ *
+ * @param dynArray The dynamic array to set the mode for.
+ * @param reclaimSlack True to use the whole allocation of the buffer, false to use exactly what was requested.
+ */
+#define ADynArray_setReclaimSlack(dynArray, reclaimSlack) \
+    private_ACUtils_ADynArray_setReclaimSlack(dynArray, reclaimSlack)
 
 /**
+ * If elements are marked as removed (see ADynArray_setLazyRemoval), dynArray is compacted first.
+ *
  * @param dynArray The dynamic array to get the buffer from.
  * @return The buffer of dynArray.
  */
 #define ADynArray_buffer(dynArray) \
-    (((dynArray) == nullptr) ? nullptr : (dynArray)->buffer)
+    (((dynArray) == nullptr) ? nullptr \
+        : ((dynArray)->tombstones != nullptr ? private_ACUtils_ADynArray_compact(dynArray, sizeof(*(dynArray)->buffer)) \
+            : (void) 0, (dynArray)->buffer))
 /**
  * @param dynArray The dynamic array to get the size from.
  * @return The size (number of elements) of the passed dynamic array.
@@ -112,6 +291,7 @@ ACUTILS_OPEN_EXTERN_C
 /**
  * Resize dynArray to the minimum size to exactly fit its content, except the buffer is smaller than the minimum size
  * that the grow strategy returns (for passed size 0).
+ * Arrays constructed with ADynArray_constructSmall move their elements back into the struct if they fit.
  *
  * @param dynArray The dynamic array to shrink the capacity to fit its content.
  * @return True if dynArray is small as possible or was successfully resized, false if not.
@@ -120,17 +300,36 @@ ACUTILS_OPEN_EXTERN_C
     private_ACUtils_ADynArray_shrinkToFit(dynArray, sizeof(*(dynArray)->buffer))
 
 /**
- * Clears the content of dynArray. The allocated buffer doesn't change.
+ * Sets the size of dynArray to newSize. If dynArray grows, its capacity is increased like by ADynArray_reserve and the
+ * new elements are set to all bits zero if zeroFill is true, otherwise their content is unspecified. If dynArray is
+ * empty and uses realloc and free, the zeroed buffer is taken from calloc, which uses fresh pages of the operating
+ * system for big buffers instead of writing zeros. If dynArray shrinks, the elements behind newSize are removed like
+ * by ADynArray_remove.
+ *
+ * If reallocation of memory fails, the dynamic array is not modified.
+ *
+ * @param dynArray The dynamic array to resize.
+ * @param newSize The number of elements dynArray should have.
+ * @param zeroFill True to set the added elements to all bits zero.
+ * @return True if dynArray has newSize elements after this operation, false if not.
+ */
+#define ADynArray_resize(dynArray, newSize, zeroFill) \
+    private_ACUtils_ADynArray_resize(dynArray, newSize, zeroFill, sizeof(*(dynArray)->buffer))
+
+/**
+ * Clears the content of dynArray. The allocated buffer doesn't change, except a shrink policy is set.
  *
  * @param dynArray The dynamic array to clear.
  */
 #define ADynArray_clear(dynArray) \
-    private_ACUtils_ADynArray_clear(dynArray)
+    private_ACUtils_ADynArray_clear(dynArray, sizeof(*(dynArray)->buffer))
 /**
- * Removes count elements in dynArray starting at index. This operation doesn't affect the capacity.
+ * Removes count elements in dynArray starting at index. This operation doesn't affect the capacity, except a shrink
+ * policy is set (see ADynArray_setShrinkPolicy).
  * The elements behind index + count are shifted to the right by count.
  *
  * If index + count is bigger or equal to the size of dynArray, all elements behind index gets removed.
+ * With lazy removal (see ADynArray_setLazyRemoval) the elements are only marked as removed.
  *
  * @param dynArray The dynamic array to remove elements from.
  * @param index The start index from which count elements should be removed.
@@ -139,6 +338,81 @@ ACUTILS_OPEN_EXTERN_C
 #define ADynArray_remove(dynArray, index, count) \
     private_ACUtils_ADynArray_remove(dynArray, index, count, sizeof(*(dynArray)->buffer))
 
+/**
+ * Removes the element at index in dynArray by moving the last element to index, so the order of the elements is not
+ * preserved, but no other element is moved. This operation doesn't affect the capacity, except a shrink policy is set.
+ *
+ * If index is bigger or equal to the size of dynArray, nothing happens.
+ * With lazy removal (see ADynArray_setLazyRemoval) the element is only marked as removed and nothing is moved.
+ *
+ * @param dynArray The dynamic array to remove the element from.
+ * @param index The index of the element to remove.
+ */
+#define ADynArray_swapRemove(dynArray, index) \
+    private_ACUtils_ADynArray_swapRemove(dynArray, index, sizeof(*(dynArray)->buffer))
+/**
+ * Removes all elements of dynArray for which predicate returns true. The kept elements stay in their order and are
+ * compacted in one pass, which calls predicate once per element (front to back) with a pointer to the element and
+ * context. This operation doesn't affect the capacity, except a shrink policy is set.
+ *
+ * @param dynArray The dynamic array to remove elements from.
+ * @param predicate The function which decides if an element is removed. This must not change dynArray!
+ * @param context The pointer which is passed to every call of predicate.
+ * @return The number of removed elements.
+ */
+#define ADynArray_removeIf(dynArray, predicate, context) \
+    private_ACUtils_ADynArray_removeIf(dynArray, predicate, context, sizeof(*(dynArray)->buffer))
+
+/**
+ * Enables or disables lazy removal for dynArray. With lazy removal ADynArray_remove, ADynArray_swapRemove and
+ * ADynArray_markRemoved only mark elements in a bitmap (one bit per element) and the marked elements are removed
+ * together in one pass, which moves every kept element at most once. Until then marked elements are still counted by
+ * ADynArray_size and returned by ADynArray_get, and every index, also the ones passed to ADynArray_insert,
+ * ADynArray_remove, ADynArray_setRange and ADynArray_applyEdits, refers to this uncompacted layout, so elements can be
+ * marked in any order. Inserting moves the marks of the elements behind the insertion along, setting a marked element
+ * keeps it again. Marking never compacts. dynArray is compacted when ADynArray_compact or ADynArray_buffer is called and
+ * before operations which don't take an index (e.g. ADynArray_resize or ADynArray_removeIf), appends keep the marks
+ * until the marked elements make up 1 / compactDivisor of the size. Disabling lazy removal compacts dynArray.
+ *
+ * @param dynArray The dynamic array to set the removal mode for.
+ * @param lazyRemoval True to enable lazy removal, false to disable it.
+ * @param compactDivisor The ratio of marked elements from which appends compact, 0 to never compact on appends.
+ * @return True on success, false if the bitmap could not be allocated.
+ */
+#define ADynArray_setLazyRemoval(dynArray, lazyRemoval, compactDivisor) \
+    private_ACUtils_ADynArray_setLazyRemoval(dynArray, lazyRemoval, compactDivisor, sizeof(*(dynArray)->buffer))
+/**
+ * Marks the element at index as removed (see ADynArray_setLazyRemoval). Marking an element twice has no effect.
+ * Without lazy removal the element is removed immediately like with ADynArray_remove(dynArray, index, 1).
+ *
+ * @param dynArray The dynamic array to remove the element from.
+ * @param index The index of the element to remove.
+ * @return True on success, false if index is out of bounds or the bitmap could not be grown.
+ */
+#define ADynArray_markRemoved(dynArray, index) \
+    private_ACUtils_ADynArray_markRemoved(dynArray, index, sizeof(*(dynArray)->buffer))
+/**
+ * @param dynArray The dynamic array to check.
+ * @param index The index of the element to check.
+ * @return True if the element at index is marked as removed and not yet compacted.
+ */
+#define ADynArray_isRemoved(dynArray, index) \
+    private_ACUtils_ADynArray_isRemoved(dynArray, index)
+/**
+ * @param dynArray The dynamic array to get the number of marked elements from.
+ * @return The number of elements which are marked as removed and not yet compacted.
+ */
+#define ADynArray_removedCount(dynArray) \
+    private_ACUtils_ADynArray_removedCount(dynArray)
+/**
+ * Removes all elements which are marked as removed. This operation doesn't affect the capacity, except a shrink
+ * policy is set.
+ *
+ * @param dynArray The dynamic array to compact.
+ */
+#define ADynArray_compact(dynArray) \
+    private_ACUtils_ADynArray_compact(dynArray, sizeof(*(dynArray)->buffer))
+
 /**
  * Inserts the value into dynArray at index. If index is bigger or equal to the size of
  * dynArray, the value gets appended.
@@ -171,7 +445,8 @@ ACUTILS_OPEN_EXTERN_C
  * destDynArray, the elements get appended.
  * Shifts all elements which were previous at or behind index, the size of srcDynArray indices, to the right.
  *
- * The elements gets copied from the buffer of srcDynArray to the buffer of destDynArray with memcpy.
+ * The elements gets copied from the buffer of srcDynArray to the buffer of destDynArray with memcpy, srcDynArray is
+ * compacted before if it has elements marked as removed.
  *
  * @param destDynArray The dynamic array in which the values should be inserted.
  * @param index The index at which the values should be inserted.
@@ -180,7 +455,8 @@ ACUTILS_OPEN_EXTERN_C
  */
 #define ADynArray_insertADynArray(destDynArray, index, srcDynArray) \
     (srcDynArray == nullptr ? \
-        destDynArray != nullptr : ADynArray_insertArray(destDynArray, index, (srcDynArray)->buffer, (srcDynArray)->size))
+        destDynArray != nullptr : (ADynArray_compact(srcDynArray), \
+            ADynArray_insertArray(destDynArray, index, (srcDynArray)->buffer, (srcDynArray)->size)))
 
 /**
  * Adds the value to the end of dynArray.
@@ -215,6 +491,53 @@ ACUTILS_OPEN_EXTERN_C
 #define ADynArray_appendADynArray(destDynArray, srcDynArray) \
     ADynArray_insertADynArray(destDynArray, ((size_t)-1), srcDynArray)
 
+/**
+ * Inserts count uninitialized elements into dynArray at index (appends them if index is bigger or equal to the size of
+ * dynArray) and returns a pointer to the first of them, so they can be written in place instead of being built in a
+ * temporary and copied. The pointer is valid until the next operation which changes the buffer of dynArray.
+ *
+ * @param dynArray The dynamic array in which the elements should be inserted.
+ * @param index The index at which the elements should be inserted.
+ * @param count The number of elements to insert.
+ * @return A pointer to the first inserted element or null on failure.
+ */
+#define ADynArray_insertUninitialized(dynArray, index, count) \
+    (((dynArray) != nullptr && private_ACUtils_ADynArray_prepareInsertion(dynArray, index, count, sizeof(*(dynArray)->buffer))) \
+        ? (dynArray)->buffer + ((size_t) (index) < (dynArray)->size - (count) ? (size_t) (index) : (dynArray)->size - (count)) \
+        : nullptr)
+/**
+ * Adds count uninitialized elements to the end of dynArray, see ADynArray_insertUninitialized.
+ *
+ * @param dynArray The dynamic array to which the elements should be added.
+ * @param count The number of elements to add.
+ * @return A pointer to the first added element or null on failure.
+ */
+#define ADynArray_appendUninitialized(dynArray, count) \
+    ADynArray_insertUninitialized(dynArray, ((size_t)-1), count)
+/**
+ * Adds one uninitialized element to the end of dynArray, see ADynArray_insertUninitialized.
+ *
+ * @param dynArray The dynamic array to which the element should be added.
+ * @return A pointer to the added element or null on failure.
+ */
+#define ADynArray_emplaceBack(dynArray) \
+    ADynArray_appendUninitialized(dynArray, 1)
+
+/**
+ * Reserves room for count elements at the end of dynArray once and lets generator write them directly into the buffer,
+ * which saves staging computed elements in a temporary array. generator gets a pointer to the first of the count
+ * uninitialized elements and context and returns how many of them it has written, only these are kept. A count of 0
+ * is a no-op which never calls generator.
+ *
+ * @param dynArray The dynamic array to which the elements should be added.
+ * @param count The maximum number of elements to add.
+ * @param generator The function which writes the elements. This must not change dynArray!
+ * @param context The pointer which is passed to generator.
+ * @return True if the room for the elements was reserved and generator was called or count is 0, false if not.
+ */
+#define ADynArray_appendGenerate(dynArray, count, generator, context) \
+    private_ACUtils_ADynArray_appendGenerate(dynArray, count, generator, context, sizeof(*(dynArray)->buffer))
+
 /**
  * Sets the element in dynArray at index to value. If index is bigger than the size of dynArray
  * The value is appended to dynArray as new element.
@@ -238,6 +561,24 @@ ACUTILS_OPEN_EXTERN_C
  */
 #define ADynArray_setRange(dynArray, index, count, value) \
     private_ACUtils_ADynArray_setRange(dynArray, index, count, &(value), sizeof(*(dynArray)->buffer))
+/**
+ * Applies a batch of edits to dynArray, each edit removes edits[i].removeCount elements starting at edits[i].index and
+ * inserts edits[i].insertCount elements copied from edits[i].insertData there. All indices refer to dynArray before the
+ * batch, so the edits must be sorted by index and must not overlap (an edit starts at or behind the end of the removed
+ * range of the previous one), several insertions at the same index are inserted in the order of the edits.
+ * The batch is applied in one sweep which moves every kept element once and reallocates at most once, instead of moving
+ * the tail of dynArray for every single edit. insertData must not point into dynArray.
+ *
+ * If the edits are invalid or reallocation of memory fails, the dynamic array is not modified (except that elements
+ * marked as removed may have been compacted).
+ *
+ * @param dynArray The dynamic array to edit.
+ * @param edits A pointer to the array of editCount edits (struct ACUtilsEdit).
+ * @param editCount The number of edits.
+ * @return True if the edits were applied, false if not.
+ */
+#define ADynArray_applyEdits(dynArray, edits, editCount) \
+    private_ACUtils_ADynArray_applyEdits(dynArray, edits, editCount, sizeof(*(dynArray)->buffer))
 /**
  * Retrieves the element at index in dynArray.
  *
@@ -250,22 +591,86 @@ ACUTILS_OPEN_EXTERN_C
 #define ADynArray_get(dynArray, index) \
     (dynArray->buffer[index])
 
+#ifndef ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE
+#   define ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE 4096
+#endif
+
+/**
+ * Grow strategies which can be passed to ADynArray_setGrowStrategy.
+ *
+ * ADynArray_growStrategyPageRounded grows like the default strategy (doubling, starting with 8 elements), but rounds
+ * buffers of at least one page up to whole pages. Meant for big buffers, which allocators usually serve with whole pages
+ * anyway, so the rounded up part is usable instead of wasted. The page size is queried from the system
+ * (sysconf(_SC_PAGESIZE), 4096 where it is not available), defining ACUTILS_ADYNARRAY_PAGE_SIZE overrides it.
+ *
+ * ADynArray_growStrategyOneAndAHalf grows by the factor 1.5 starting with 8 elements. Needs more reallocations than
+ * doubling, but wastes less memory and allows the allocator to reuse the space of previously freed buffers for a
+ * later growth, which also makes in place reallocation more likely.
+ *
+ * ADynArray_growStrategySizeClass rounds the buffer size in bytes up to the next size class of common allocators
+ * (multiples of 16 up to 128 bytes, above four classes per power of two as jemalloc uses them). The capacity grows by
+ * at least 12.5 % and every byte the allocator hands out is used, which suits many small arrays.
+ *
+ * ADynArray_growStrategyExact returns requiredSize (at least 1), so buffers are exactly as big as needed. Every growth
+ * reallocates, which is only cheap if elements are added in big batches (e.g. for many short strings which are built
+ * once and never change).
+ *
+ * ADynArray_growStrategyLinearChunk rounds the capacity up to a multiple of ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE bytes
+ * (at least one element). It wastes at most one chunk, but appending element by element copies the buffer once per
+ * chunk, so it should only be used if the final size is roughly known or the allocator can grow in place.
+ *
+ * @param requiredSize The number of elements the buffer must be able to hold.
+ * @param typeSize The size of one element in bytes.
+ * @return The capacity (in elements) for the buffer.
+ */
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyPageRounded(size_t requiredSize, size_t typeSize);
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyOneAndAHalf(size_t requiredSize, size_t typeSize);
+ACUTILS_HD_FUNC size_t ADynArray_growStrategySizeClass(size_t requiredSize, size_t typeSize);
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyLinearChunk(size_t requiredSize, size_t typeSize);
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyExact(size_t requiredSize, size_t typeSize);
+
 #ifdef ACUTILS_ONE_SOURCE
 #   include "../../src/adynarray.c"
 #else
     size_t private_ACUtils_ADynArray_growStrategyGeneric(size_t, size_t, size_t, double, size_t);
     void* private_ACUtils_ADynArray_construct(size_t);
     void* private_ACUtils_ADynArray_constructWithAllocator(size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    void* private_ACUtils_ADynArray_constructWithAllocatorObject(size_t, const struct ACUtilsAllocator*);
+    void* private_ACUtils_ADynArray_constructCompact(size_t);
+    void* private_ACUtils_ADynArray_constructCompactWithAllocator(size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    void* private_ACUtils_ADynArray_constructCompactWithAllocatorObject(size_t, const struct ACUtilsAllocator*);
+    void* private_ACUtils_ADynArray_constructAligned(size_t, size_t);
+    void* private_ACUtils_ADynArray_constructAlignedWithAllocator(size_t, size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    void* private_ACUtils_ADynArray_constructAlignedWithAllocatorObject(size_t, size_t, const struct ACUtilsAllocator*);
+    void* private_ACUtils_ADynArray_constructSmall(size_t, size_t, size_t, size_t);
+    void* private_ACUtils_ADynArray_constructSmallWithAllocator(size_t, size_t, size_t, size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    void* private_ACUtils_ADynArray_constructSmallWithAllocatorObject(size_t, size_t, size_t, size_t, const struct ACUtilsAllocator*);
     void private_ACUtils_ADynArray_destruct(void*);
     void private_ACUtils_ADynArray_setGrowStrategy(void*, ACUtilsGrowStrategy);
+    void private_ACUtils_ADynArray_setReclaimSlack(void*, bool);
     size_t private_ACUtils_ADynArray_size(const void*);
     size_t private_ACUtils_ADynArray_capacity(const void*);
     bool private_ACUtils_ADynArray_reserve(void*, size_t, bool, size_t);
     bool private_ACUtils_ADynArray_shrinkToFit(void*, size_t);
-    void private_ACUtils_ADynArray_clear(void*);
+    bool private_ACUtils_ADynArray_resize(void*, size_t, bool, size_t);
+    void private_ACUtils_ADynArray_setShrinkPolicy(void*, unsigned int);
+    void private_ACUtils_ADynArray_clear(void*, size_t);
     void private_ACUtils_ADynArray_remove(void*, size_t, size_t, size_t);
+    void private_ACUtils_ADynArray_swapRemove(void*, size_t, size_t);
+    size_t private_ACUtils_ADynArray_removeIf(void*, ACUtilsPredicate, void*, size_t);
+    bool private_ACUtils_ADynArray_setLazyRemoval(void*, bool, unsigned int, size_t);
+    bool private_ACUtils_ADynArray_markRemoved(void*, size_t, size_t);
+    bool private_ACUtils_ADynArray_isRemoved(const void*, size_t);
+    size_t private_ACUtils_ADynArray_removedCount(const void*);
+    void private_ACUtils_ADynArray_compact(void*, size_t);
+    bool private_ACUtils_ADynArray_prepareInsertion(void*, size_t, size_t, size_t);
     bool private_ACUtils_ADynArray_insertArray(void*, size_t, const void*, size_t, size_t);
+    bool private_ACUtils_ADynArray_appendGenerate(void*, size_t, ACUtilsGenerator, void*, size_t);
     bool private_ACUtils_ADynArray_setRange(void*, size_t, size_t, void*, size_t);
+    void private_ACUtils_ADynArray_fill(void*, const void*, size_t, size_t);
+    bool private_ACUtils_ADynArray_editedSize(size_t, const struct ACUtilsEdit*, size_t, size_t*);
+    void private_ACUtils_ADynArray_applyEditsToBuffer(char*, char*, size_t, const struct ACUtilsEdit*, size_t, size_t);
+    bool private_ACUtils_ADynArray_applyEdits(void*, const struct ACUtilsEdit*, size_t, size_t);
 #endif
 
 ACUTILS_CLOSE_EXTERN_C
@@ -0,0 +1,42 @@
+#ifndef ACUTILS_APAGEALLOCATOR_H
+#define ACUTILS_APAGEALLOCATOR_H
+
+#include "macros.h"
+#include "types.h"
+
+ACUTILS_OPEN_EXTERN_C
+
+#ifndef ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD
+#   define ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD (2 * 1024 * 1024)
+#endif
+
+/**
+ * An allocator for very large buffers, e.g. for dynamic arrays or strings which grow to hundreds of megabytes:
+ *
+ *     struct ACUtilsAllocator allocator = APageAllocator_allocator();
+ *     struct IntArray *column = ADynArray_constructWithAllocatorObject(struct IntArray, &allocator);
+ *
+ * Allocations of at least ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD bytes get their own anonymous memory mapping, which is
+ * advised to use transparent huge pages (MADV_HUGEPAGE) and grows or shrinks with mremap, so the kernel moves page
+ * table entries instead of copying the content. Smaller allocations are served by malloc and move to a mapping once
+ * they are reallocated beyond the threshold. Where mmap or mremap are not available the allocator falls back to
+ * malloc or to copying.
+ * Mappings are rounded up to whole pages of the size the system reports (sysconf(_SC_PAGESIZE)), defining
+ * ACUTILS_APAGEALLOCATOR_PAGE_SIZE overrides it.
+ * Every allocation starts with a small header that stores its sizes, so the returned pointers are aligned for every
+ * type but not to a page boundary, even if the allocation is a mapping of its own.
+ * The allocator has no state, the context of the returned allocator object is null.
+ */
+ACUTILS_HD_FUNC struct ACUtilsAllocator APageAllocator_allocator(void);
+
+ACUTILS_HD_FUNC void* APageAllocator_reallocate(void *context, void *ptr, size_t size);
+ACUTILS_HD_FUNC void APageAllocator_deallocate(void *context, void *ptr);
+ACUTILS_HD_FUNC size_t APageAllocator_usableSize(void *context, void *ptr);
+
+#ifdef ACUTILS_ONE_SOURCE
+#   include "../../src/apageallocator.c"
+#endif
+
+ACUTILS_CLOSE_EXTERN_C
+
+#endif /* ACUTILS_APAGEALLOCATOR_H */
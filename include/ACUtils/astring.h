@@ -9,16 +9,51 @@ ACUTILS_OPEN_EXTERN_C
 
 struct AString;
 A_DYNAMIC_ARRAY_DEFINITION(ASplittedString, struct AString*);
+A_DYNAMIC_ARRAY_DEFINITION(AStringOffsets, size_t);
+
+/* Returned by the find functions if there is no match. */
+#define ACUTILS_ASTRING_NOT_FOUND ((size_t) -1)
+
+/* Number of bytes a caller provided buffer needs for the struct of an AString (including alignment padding). */
+#define ACUTILS_ASTRING_STRUCT_STORAGE_SIZE (16 * sizeof(void*))
 
 ACUTILS_HD_FUNC struct AString* AString_construct(void);
 ACUTILS_HD_FUNC struct AString* AString_constructFromCString(const char *cstr, size_t len);
 ACUTILS_HD_FUNC struct AString* AString_constructWithAllocator(ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
 ACUTILS_HD_FUNC struct AString* AString_constructFromCStringWithAllocator(const char *cstr, size_t len, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
 ACUTILS_HD_FUNC struct AString* AString_constructWithCapacityAndAllocator(size_t capacity, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC struct AString* AString_constructWithAllocatorObject(const struct ACUtilsAllocator *allocator);
+ACUTILS_HD_FUNC struct AString* AString_constructFromCStringWithAllocatorObject(const char *cstr, size_t len, const struct ACUtilsAllocator *allocator);
+ACUTILS_HD_FUNC struct AString* AString_constructWithCapacityAndAllocatorObject(size_t capacity, const struct ACUtilsAllocator *allocator);
+ACUTILS_HD_FUNC struct AString* AString_constructCompactFromCString(const char *cstr, size_t len);
+ACUTILS_HD_FUNC struct AString* AString_constructCompactWithCapacityAndAllocator(size_t capacity, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC struct AString* AString_constructCompactWithCapacityAndAllocatorObject(size_t capacity, const struct ACUtilsAllocator *allocator);
+/* Small strings keep up to ACUTILS_ASTRING_SMALL_CAPACITY chars in the allocation of the struct and only use a heap
+ * buffer while their content is longer. Clones and substrings of small strings (also from split) are small strings. */
+ACUTILS_HD_FUNC struct AString* AString_constructSmall(void);
+ACUTILS_HD_FUNC struct AString* AString_constructSmallFromCString(const char *cstr, size_t len);
+ACUTILS_HD_FUNC struct AString* AString_constructSmallWithAllocator(ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC struct AString* AString_constructSmallWithAllocatorObject(const struct ACUtilsAllocator *allocator);
+ACUTILS_HD_FUNC struct AString* AString_constructSmallFromCStringWithAllocatorObject(const char *cstr, size_t len, const struct ACUtilsAllocator *allocator);
+/* Strings in a caller provided buffer place their struct and as many chars as fit into the buffer and only allocate if
+ * they outgrow it. Strings from a literal point to the literal (which must be '\0' terminated at len) and copy it to an
+ * own allocation before their first change, their buffer needs only ACUTILS_ASTRING_STRUCT_STORAGE_SIZE bytes. The
+ * buffer must outlive the string, AString_destruct releases what was allocated but never the buffer itself. */
+ACUTILS_HD_FUNC struct AString* AString_constructInBuffer(void *buffer, size_t bufferSize);
+ACUTILS_HD_FUNC struct AString* AString_constructInBufferWithAllocator(void *buffer, size_t bufferSize, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC struct AString* AString_constructFromLiteral(void *buffer, size_t bufferSize, const char *literal, size_t len);
+ACUTILS_HD_FUNC struct AString* AString_constructFromLiteralWithAllocator(void *buffer, size_t bufferSize, const char *literal, size_t len, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
 ACUTILS_HD_FUNC void AString_destruct(struct AString *str);
 
 ACUTILS_HD_FUNC ACUtilsReallocator AString_reallocator(const struct AString *str);
 ACUTILS_HD_FUNC ACUtilsDeallocator AString_deallocator(const struct AString *str);
+ACUTILS_HD_FUNC const struct ACUtilsAllocator* AString_allocator(const struct AString *str);
+/* The grow strategy gets the required number of chars (without '\0') and sizeof(char), null means the default growth
+ * (powers of two starting with 8, at most 1024 chars more than required). Clones and substrings take it over. */
+ACUTILS_HD_FUNC ACUtilsGrowStrategy AString_growStrategy(const struct AString *str);
+ACUTILS_HD_FUNC void AString_setGrowStrategy(struct AString *str, ACUtilsGrowStrategy growStrategy);
+/* If enabled, the capacity is raised to what the allocator really handed out (see ADynArray_setReclaimSlack). */
+ACUTILS_HD_FUNC void AString_setReclaimSlack(struct AString *str, bool reclaimSlack);
 
 ACUTILS_HD_FUNC const char* AString_buffer(const struct AString *str);
 ACUTILS_HD_FUNC size_t AString_capacity(const struct AString *str);
@@ -51,12 +86,28 @@ ACUTILS_HD_FUNC bool AString_replaceRangeAString(struct AString *str, size_t ind
 ACUTILS_HD_FUNC void AString_replace(struct AString *str, char old, char rep, size_t count);
 ACUTILS_HD_FUNC bool AString_replaceCString(struct AString *str, const char *old, size_t oldLen, const char *rep, size_t newLen, size_t count);
 ACUTILS_HD_FUNC bool AString_replaceAString(struct AString *str, const struct AString *old, const struct AString *rep, size_t count);
+/* Applies sorted, non overlapping edits (insertData are chars, see ADynArray_applyEdits) in one sweep which moves every
+ * char once and reallocates at most once. On failure str is not modified. */
+ACUTILS_HD_FUNC bool AString_applyEdits(struct AString *str, const struct ACUtilsEdit *edits, size_t editCount);
 
 ACUTILS_HD_FUNC bool AString_equals(const struct AString *str1, const struct AString *str2);
 ACUTILS_HD_FUNC bool AString_equalsCString(const struct AString *str, const char *cstr);
 ACUTILS_HD_FUNC int AString_compare(const struct AString *str1, const struct AString *str2);
 ACUTILS_HD_FUNC int AString_compareCString(const struct AString *str, const char *cstr);
 
+/* Return the index of the first match which starts at or behind index (find) or the last match which starts at or
+ * before index (rfind, ACUTILS_ASTRING_NOT_FOUND searches the whole string), an empty needle matches at index. Needles
+ * are found by filtering for their first char (with memchr in find), needles of at least 16 chars with
+ * Boyer-Moore-Horspool in both directions. */
+ACUTILS_HD_FUNC size_t AString_find(const struct AString *str, size_t index, const struct AString *needle);
+ACUTILS_HD_FUNC size_t AString_findCString(const struct AString *str, size_t index, const char *cstr, size_t len);
+ACUTILS_HD_FUNC size_t AString_rfind(const struct AString *str, size_t index, const struct AString *needle);
+ACUTILS_HD_FUNC size_t AString_rfindCString(const struct AString *str, size_t index, const char *cstr, size_t len);
+/* Returns the indices of all non overlapping matches (front to back) in an array which uses the allocator of str and is
+ * freed with ADynArray_destruct, null if the needle is empty or on failure. */
+ACUTILS_HD_FUNC struct AStringOffsets* AString_findAll(const struct AString *str, const struct AString *needle);
+ACUTILS_HD_FUNC struct AStringOffsets* AString_findAllCString(const struct AString *str, const char *cstr, size_t len);
+
 ACUTILS_HD_FUNC struct AString* AString_clone(const struct AString *str);
 ACUTILS_HD_FUNC struct AString* AString_substring(const struct AString *str, size_t index, size_t count);
 
@@ -0,0 +1,61 @@
+#ifndef ACUTILS_ASTRINGREPLACER_H
+#define ACUTILS_ASTRINGREPLACER_H
+
+#include "macros.h"
+#include "types.h"
+#include "adynarray.h"
+#include "astring.h"
+
+ACUTILS_OPEN_EXTERN_C
+
+struct AStringReplacer;
+
+/**
+ * One entry of the table an AStringReplacer is compiled from: every match of pattern is replaced by replacement.
+ * pattern must not be empty, replacement may be null if replacementLen is 0.
+ */
+struct AStringReplacement
+{
+    const char *pattern;
+    size_t patternLen;
+    const char *replacement;
+    size_t replacementLen;
+};
+/**
+ * A match found by an AStringReplacer: the pattern with the index pattern in the table starts at index.
+ */
+struct AStringMatch
+{
+    size_t index;
+    size_t pattern;
+};
+A_DYNAMIC_ARRAY_DEFINITION(AStringMatches, struct AStringMatch);
+
+/* Compiles the table into an Aho-Corasick automaton (a DFA over the bytes which occur in the patterns), so any number
+ * of patterns is found in one scan over a string: only the text read ahead behind a match, at most the length of the
+ * longest pattern, is read again, finding all matches takes O(size + matchCount * longest pattern length). The table is copied and doesn't need to outlive the replacer. Matches
+ * don't overlap and are chosen leftmost-longest: the match which starts first wins and of the matches starting there
+ * the longest, if a pattern occurs several times in the table the first entry is used. */
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_construct(const struct AStringReplacement *table, size_t count);
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_constructWithAllocator(const struct AStringReplacement *table, size_t count, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+/* The replacer and the arrays returned by AStringReplacer_findAny are allocated through allocator. */
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_constructWithAllocatorObject(const struct AStringReplacement *table, size_t count, const struct ACUtilsAllocator *allocator);
+ACUTILS_HD_FUNC void AStringReplacer_destruct(struct AStringReplacer *replacer);
+
+ACUTILS_HD_FUNC size_t AStringReplacer_patternCount(const struct AStringReplacer *replacer);
+
+/* Stores the first match which starts at or behind index in match and returns true, false if there is none. */
+ACUTILS_HD_FUNC bool AStringReplacer_find(const struct AStringReplacer *replacer, const struct AString *str, size_t index, struct AStringMatch *match);
+/* Returns all matches (front to back) in an array which uses the allocator of replacer and is freed with
+ * ADynArray_destruct, null on failure. */
+ACUTILS_HD_FUNC struct AStringMatches* AStringReplacer_findAny(const struct AStringReplacer *replacer, const struct AString *str);
+/* Replaces all matches in one sweep (see AString_applyEdits), on failure str is not modified. */
+ACUTILS_HD_FUNC bool AStringReplacer_apply(const struct AStringReplacer *replacer, struct AString *str);
+
+#ifdef ACUTILS_ONE_SOURCE
+#   include "../../src/astringreplacer.c"
+#endif
+
+ACUTILS_CLOSE_EXTERN_C
+
+#endif /* ACUTILS_ASTRINGREPLACER_H */
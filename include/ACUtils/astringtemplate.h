@@ -0,0 +1,47 @@
+#ifndef ACUTILS_ASTRINGTEMPLATE_H
+#define ACUTILS_ASTRINGTEMPLATE_H
+
+#include "macros.h"
+#include "types.h"
+#include "astring.h"
+
+ACUTILS_OPEN_EXTERN_C
+
+struct AStringTemplate;
+
+/**
+ * The value of one slot of an AStringTemplate, cstr may be null if len is 0.
+ */
+struct AStringTemplateValue
+{
+    const char *cstr;
+    size_t len;
+};
+
+/* Parses a template with {name} placeholders once into a list of literals and slots. Every distinct name is one slot,
+ * the slots are numbered in the order their names first occur. "{{" and "}}" stand for literal braces, null is returned
+ * for empty names, braces inside names and braces which are not closed or escaped. */
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_construct(const struct AString *templateStr);
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_constructFromCString(const char *cstr, size_t len);
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_constructFromCStringWithAllocator(const char *cstr, size_t len, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator);
+ACUTILS_HD_FUNC void AStringTemplate_destruct(struct AStringTemplate *stringTemplate);
+
+ACUTILS_HD_FUNC size_t AStringTemplate_slotCount(const struct AStringTemplate *stringTemplate);
+/* Returns the slot of the placeholder name or ACUTILS_ASTRING_NOT_FOUND if the template doesn't contain it. */
+ACUTILS_HD_FUNC size_t AStringTemplate_slotIndex(const struct AStringTemplate *stringTemplate, const char *name, size_t len);
+
+/* values needs one entry per slot. Returns the number of chars rendering produces or ACUTILS_ASTRING_NOT_FOUND if a value
+ * is invalid or the size doesn't fit into size_t. */
+ACUTILS_HD_FUNC size_t AStringTemplate_renderedSize(const struct AStringTemplate *stringTemplate, const struct AStringTemplateValue *values);
+/* Appends the template with the placeholders replaced by values to out. out is reserved once for the exact size, so
+ * rendering into a cleared string which is reused doesn't allocate once it is big enough. Values may point into the
+ * content of out. On failure out is not modified. */
+ACUTILS_HD_FUNC bool AStringTemplate_render(const struct AStringTemplate *stringTemplate, const struct AStringTemplateValue *values, struct AString *out);
+
+#ifdef ACUTILS_ONE_SOURCE
+#   include "../../src/astringtemplate.c"
+#endif
+
+ACUTILS_CLOSE_EXTERN_C
+
+#endif /* ACUTILS_ASTRINGTEMPLATE_H */
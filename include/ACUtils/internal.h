@@ -0,0 +1,33 @@
+#ifndef ACUTILS_INTERNAL_H
+#define ACUTILS_INTERNAL_H
+
+/* helpers shared by the sources of the library, not part of its interface */
+
+#include <stddef.h>
+#if defined(__unix__) || defined(__APPLE__)
+#   include <unistd.h>
+#endif
+
+/* the page size of the system (16K or 64K on some arm64 and ppc64le kernels), 4096 where it can't be queried. It is
+ * queried on every use instead of cached, which is cheap and leaves no shared state to race on. */
+#ifdef _SC_PAGESIZE
+#   define private_ACUtils_systemPageSize() ((size_t) sysconf(_SC_PAGESIZE))
+#else
+#   define private_ACUtils_systemPageSize() ((size_t) 4096)
+#endif
+
+/* memory aligned for this union is aligned for every type (in C90 there is no max_align_t) */
+union private_ACUtils_MaxAlign
+{
+    long l;
+    double d;
+    long double ld;
+    void *p;
+    void (*f)(void);
+};
+/* rounds size up to a multiple of the alignment of every type, so data placed behind a header of size is aligned */
+#define private_ACUtils_alignUp(size) \
+    (((size) + sizeof(union private_ACUtils_MaxAlign) - 1) / sizeof(union private_ACUtils_MaxAlign) \
+     * sizeof(union private_ACUtils_MaxAlign))
+
+#endif /* ACUTILS_INTERNAL_H */
@@ -16,5 +16,37 @@
 typedef void*(*ACUtilsReallocator)(void* ptr, size_t size);
 typedef void(*ACUtilsDeallocator)(void* ptr);
 typedef size_t(*ACUtilsGrowStrategy)(size_t requiredSize, size_t typeSize);
+typedef bool(*ACUtilsPredicate)(const void *element, void *context);
+typedef size_t(*ACUtilsGenerator)(void *elements, size_t count, void *context);
+
+typedef void*(*ACUtilsContextReallocator)(void *context, void *ptr, size_t size);
+typedef void(*ACUtilsContextDeallocator)(void *context, void *ptr);
+typedef size_t(*ACUtilsContextUsableSize)(void *context, void *ptr);
+
+/**
+ * An allocator which passes its context pointer to every call of reallocator and deallocator. This allows to use
+ * allocators with their own state (e.g. an arena per request) without global variables.
+ * usableSize is optional, if set it returns the number of bytes that can be used in an allocation of the allocator,
+ * which may be more than requested.
+ */
+struct ACUtilsAllocator
+{
+    ACUtilsContextReallocator reallocator;
+    ACUtilsContextDeallocator deallocator;
+    void *context;
+    ACUtilsContextUsableSize usableSize;
+};
+
+/**
+ * One edit for ADynArray_applyEdits and AString_applyEdits: removes removeCount elements starting at index and inserts
+ * insertCount elements from insertData there. index refers to the positions before any edit of the batch is applied.
+ */
+struct ACUtilsEdit
+{
+    size_t index;
+    size_t removeCount;
+    const void *insertData;
+    size_t insertCount;
+};
 
 #endif /* ACUTILS_TYPES_H */
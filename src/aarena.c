@@ -0,0 +1,234 @@
+#ifndef ACUTILS_ONE_SOURCE
+#   include "../include/ACUtils/aarena.h"
+#endif
+
+#ifdef ACUTILS_AARENA_H /* if compiled as one source and not included from header, the definitions are excluded */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/ACUtils/internal.h"
+
+/* every allocation is prefixed with its size and aligned to the strictest fundamental alignment */
+struct private_ACUtils_AArena_AllocationHeader
+{
+    size_t size;
+};
+struct private_ACUtils_AArena_Block
+{
+    struct private_ACUtils_AArena_Block *previous;
+    size_t capacity;
+    size_t used;
+};
+
+struct AArena
+{
+    const ACUtilsReallocator reallocator;
+    const ACUtilsDeallocator deallocator;
+    size_t blockSize;
+    struct private_ACUtils_AArena_Block *current;
+    struct private_ACUtils_AArena_Block *spare;
+};
+
+static const size_t private_ACUtils_AArena_blockSizeDefault = 4096;
+#define private_ACUtils_AArena_blockHeaderSize \
+    private_ACUtils_alignUp(sizeof(struct private_ACUtils_AArena_Block))
+#define private_ACUtils_AArena_allocationHeaderSize \
+    private_ACUtils_alignUp(sizeof(struct private_ACUtils_AArena_AllocationHeader))
+
+static char* private_ACUtils_AArena_blockData(struct private_ACUtils_AArena_Block *block)
+{
+    return ((char*) block) + private_ACUtils_AArena_blockHeaderSize;
+}
+static struct private_ACUtils_AArena_AllocationHeader* private_ACUtils_AArena_header(void *ptr)
+{
+    return (struct private_ACUtils_AArena_AllocationHeader*) (((char*) ptr) - private_ACUtils_AArena_allocationHeaderSize);
+}
+/* returns true if ptr is the last allocation in the current block of arena */
+static bool private_ACUtils_AArena_isLastAllocation(const struct AArena *arena, void *ptr)
+{
+    if(arena->current == NULL)
+        return false;
+    return ((char*) ptr) + private_ACUtils_AArena_header(ptr)->size
+           == private_ACUtils_AArena_blockData(arena->current) + arena->current->used;
+}
+static void private_ACUtils_AArena_releaseBlock(struct AArena *arena, struct private_ACUtils_AArena_Block *block)
+{
+    /* keep one block of the default size to avoid allocator traffic if the arena is used in a loop */
+    if(arena->spare == NULL && block->capacity == arena->blockSize)
+        arena->spare = block;
+    else
+        arena->deallocator(block);
+}
+static bool private_ACUtils_AArena_pushBlock(struct AArena *arena, size_t requiredSize)
+{
+    struct private_ACUtils_AArena_Block *block;
+    if(requiredSize <= arena->blockSize && arena->spare != NULL) {
+        block = arena->spare;
+        arena->spare = NULL;
+    } else {
+        size_t capacity = (requiredSize > arena->blockSize) ? requiredSize : arena->blockSize;
+        if(capacity > ((size_t) -1) - private_ACUtils_AArena_blockHeaderSize)
+            return false;
+        block = (struct private_ACUtils_AArena_Block*) arena->reallocator(NULL, private_ACUtils_AArena_blockHeaderSize + capacity);
+        if(block == NULL)
+            return false;
+        block->capacity = capacity;
+    }
+    block->used = 0;
+    block->previous = arena->current;
+    arena->current = block;
+    return true;
+}
+
+static void* private_ACUtils_AArena_allocatorReallocate(void *context, void *ptr, size_t size)
+{
+    return AArena_reallocate((struct AArena*) context, ptr, size);
+}
+static void private_ACUtils_AArena_allocatorDeallocate(void *context, void *ptr)
+{
+    AArena_deallocate((struct AArena*) context, ptr);
+}
+static size_t private_ACUtils_AArena_allocatorUsableSize(void *context, void *ptr)
+{
+    (void) context; /* suppress unused warning */
+    return private_ACUtils_AArena_header(ptr)->size;
+}
+
+ACUTILS_HD_FUNC struct AArena* AArena_construct(void)
+{
+    return AArena_constructWithBlockSizeAndAllocator(private_ACUtils_AArena_blockSizeDefault, realloc, free);
+}
+ACUTILS_HD_FUNC struct AArena* AArena_constructWithBlockSize(size_t blockSize)
+{
+    return AArena_constructWithBlockSizeAndAllocator(blockSize, realloc, free);
+}
+ACUTILS_HD_FUNC struct AArena* AArena_constructWithBlockSizeAndAllocator(size_t blockSize, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    struct AArena *arena;
+    if(reallocator == NULL || deallocator == NULL || blockSize == 0)
+        return NULL;
+    arena = (struct AArena*) reallocator(NULL, sizeof(struct AArena));
+    if(arena != NULL) {
+        struct AArena tmpArena = {reallocator, deallocator};
+        memcpy(arena, &tmpArena, sizeof(struct AArena));
+        arena->blockSize = private_ACUtils_alignUp(blockSize);
+        arena->current = NULL;
+        arena->spare = NULL;
+    }
+    return arena;
+}
+ACUTILS_HD_FUNC void AArena_destruct(struct AArena *arena)
+{
+    if(arena != NULL) {
+        struct AArenaMark emptyMark = {NULL, 0};
+        AArena_rewind(arena, emptyMark);
+        if(arena->spare != NULL)
+            arena->deallocator(arena->spare);
+        arena->deallocator(arena);
+    }
+}
+
+ACUTILS_HD_FUNC struct ACUtilsAllocator AArena_allocator(struct AArena *arena)
+{
+    struct ACUtilsAllocator allocator = {NULL, NULL, NULL, NULL};
+    if(arena != NULL) {
+        allocator.reallocator = private_ACUtils_AArena_allocatorReallocate;
+        allocator.deallocator = private_ACUtils_AArena_allocatorDeallocate;
+        allocator.context = arena;
+        allocator.usableSize = private_ACUtils_AArena_allocatorUsableSize;
+    }
+    return allocator;
+}
+
+ACUTILS_HD_FUNC void* AArena_allocate(struct AArena *arena, size_t size)
+{
+    size_t requiredSize;
+    char *ptr;
+    if(arena == NULL || size > ((size_t) -1) / 2)
+        return NULL;
+    requiredSize = private_ACUtils_AArena_allocationHeaderSize + private_ACUtils_alignUp(size);
+    if(arena->current == NULL || arena->current->capacity - arena->current->used < requiredSize) {
+        if(!private_ACUtils_AArena_pushBlock(arena, requiredSize))
+            return NULL;
+    }
+    ptr = private_ACUtils_AArena_blockData(arena->current) + arena->current->used + private_ACUtils_AArena_allocationHeaderSize;
+    private_ACUtils_AArena_header(ptr)->size = private_ACUtils_alignUp(size);
+    arena->current->used += requiredSize;
+    return ptr;
+}
+ACUTILS_HD_FUNC void* AArena_reallocate(struct AArena *arena, void *ptr, size_t size)
+{
+    size_t oldSize;
+    void *newPtr;
+    if(arena == NULL)
+        return NULL;
+    else if(ptr == NULL)
+        return AArena_allocate(arena, size);
+    oldSize = private_ACUtils_AArena_header(ptr)->size;
+    if(size <= oldSize)
+        return ptr;
+    if(private_ACUtils_AArena_isLastAllocation(arena, ptr) && size <= ((size_t) -1) / 2) {
+        size_t growSize = private_ACUtils_alignUp(size) - oldSize;
+        if(arena->current->capacity - arena->current->used >= growSize) {
+            arena->current->used += growSize;
+            private_ACUtils_AArena_header(ptr)->size += growSize;
+            return ptr;
+        }
+    }
+    newPtr = AArena_allocate(arena, size);
+    if(newPtr != NULL)
+        memcpy(newPtr, ptr, oldSize);
+    return newPtr;
+}
+ACUTILS_HD_FUNC void AArena_deallocate(struct AArena *arena, void *ptr)
+{
+    /* only the most recent allocation can be given back, everything else is released by rewind/clear/destruct */
+    if(arena != NULL && ptr != NULL && private_ACUtils_AArena_isLastAllocation(arena, ptr))
+        arena->current->used -= private_ACUtils_AArena_allocationHeaderSize + private_ACUtils_AArena_header(ptr)->size;
+}
+
+ACUTILS_HD_FUNC size_t AArena_usedSize(const struct AArena *arena)
+{
+    size_t usedSize = 0;
+    struct private_ACUtils_AArena_Block *block;
+    if(arena == NULL)
+        return 0;
+    for(block = arena->current; block != NULL; block = block->previous)
+        usedSize += block->used;
+    return usedSize;
+}
+
+ACUTILS_HD_FUNC struct AArenaMark AArena_mark(const struct AArena *arena)
+{
+    struct AArenaMark mark = {NULL, 0};
+    if(arena != NULL && arena->current != NULL) {
+        mark.block = arena->current;
+        mark.used = arena->current->used;
+    }
+    return mark;
+}
+ACUTILS_HD_FUNC void AArena_rewind(struct AArena *arena, struct AArenaMark mark)
+{
+    if(arena == NULL)
+        return;
+    while(arena->current != NULL && arena->current != mark.block) {
+        struct private_ACUtils_AArena_Block *previous = arena->current->previous;
+        private_ACUtils_AArena_releaseBlock(arena, arena->current);
+        arena->current = previous;
+    }
+    if(arena->current != NULL && mark.used < arena->current->used)
+        arena->current->used = mark.used;
+}
+ACUTILS_HD_FUNC void AArena_clear(struct AArena *arena)
+{
+    struct AArenaMark mark = {NULL, 0};
+    if(arena == NULL || arena->current == NULL)
+        return;
+    mark.block = arena->current;
+    while(((struct private_ACUtils_AArena_Block*) mark.block)->previous != NULL)
+        mark.block = ((struct private_ACUtils_AArena_Block*) mark.block)->previous;
+    AArena_rewind(arena, mark);
+}
+
+#endif /* ACUTILS_AARENA_H */
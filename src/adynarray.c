@@ -4,22 +4,62 @@
 #   include "../include/ACUtils/macros.h"
 #   include "../include/ACUtils/types.h"
     ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructWithAllocator(size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructWithAllocatorObject(size_t, const struct ACUtilsAllocator*);
+    ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructCompactWithAllocator(size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructAlignedWithAllocator(size_t, size_t, ACUtilsReallocator, ACUtilsDeallocator);
+    ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructSmallWithAllocator(size_t, size_t, size_t, size_t, ACUtilsReallocator, ACUtilsDeallocator);
     ACUTILS_HD_FUNC void private_ACUtils_ADynArray_destruct(void*);
+    ACUTILS_HD_FUNC void private_ACUtils_ADynArray_compact(void*, size_t);
 #endif
 
 #ifdef ACUTILS_ADYNARRAY_H /* if compiled as one source and not included from header, the definitions are excluded */
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
+#include <limits.h>
+#ifdef __GLIBC__
+#   include <malloc.h>
+#endif
+
+#include "../include/ACUtils/internal.h"
 
+/* returns the smallest power of two that is not smaller than value or 0 if it doesn't fit into size_t */
+static size_t private_ACUtils_ADynArray_nextPowerOfTwo(size_t value)
+{
+    size_t shift;
+    if(value <= 1)
+        return 1;
+    --value;
+    for(shift = 1; shift < sizeof(size_t) * CHAR_BIT; shift <<= 1)
+        value |= value >> shift;
+    return value + 1;
+}
 ACUTILS_HD_FUNC size_t private_ACUtils_ADynArray_growStrategyGeneric(size_t requiredSize, size_t minCapacity, size_t maxCapacity, double multiplier, size_t maxDifSize) {
-    double multiplierExponent;
     size_t capacity;
     if(requiredSize <= minCapacity)
         return minCapacity;
-    multiplierExponent = ceil(log((double) requiredSize / minCapacity) / log(multiplier));
-    capacity = (size_t) (minCapacity * pow(multiplier, multiplierExponent));
+    if(minCapacity == 0)
+        minCapacity = 1;
+    /* capacity = minCapacity * multiplier^n with the smallest n for which capacity >= requiredSize, saturated at the
+     * maximum of size_t if it doesn't fit */
+    if(multiplier == 2) {
+        size_t factor = private_ACUtils_ADynArray_nextPowerOfTwo((requiredSize - 1) / minCapacity + 1);
+        capacity = (factor == 0 || factor > ((size_t) -1) / minCapacity) ? ((size_t) -1) : minCapacity * factor;
+    } else if(multiplier >= 3 && multiplier == (double) (size_t) multiplier) {
+        size_t intMultiplier = (size_t) multiplier;
+        capacity = minCapacity;
+        while(capacity < requiredSize)
+            capacity = (capacity > ((size_t) -1) / intMultiplier) ? ((size_t) -1) : capacity * intMultiplier;
+    } else if(multiplier > 1) {
+        double exactCapacity = (double) minCapacity;
+        while(exactCapacity < (double) requiredSize)
+            exactCapacity *= multiplier;
+        capacity = (exactCapacity >= (double) ((size_t) -1)) ? ((size_t) -1) : (size_t) exactCapacity;
+        if(capacity < requiredSize)
+            capacity = requiredSize;
+    } else {
+        capacity = requiredSize;
+    }
     if(capacity - requiredSize > maxDifSize)
         capacity = requiredSize + maxDifSize;
     if(capacity > maxCapacity)
@@ -31,40 +71,312 @@ static size_t private_ACUtils_ADynArray_growStrategyDefault(size_t requiredSize,
     return private_ACUtils_ADynArray_growStrategyGeneric(requiredSize, 8, -1, 2, 1000000);
 }
 
+/* the page size of the system unless it is overridden */
+static size_t private_ACUtils_ADynArray_pageSize(void)
+{
+#ifdef ACUTILS_ADYNARRAY_PAGE_SIZE
+    return ACUTILS_ADYNARRAY_PAGE_SIZE;
+#else
+    return private_ACUtils_systemPageSize();
+#endif
+}
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyPageRounded(size_t requiredSize, size_t typeSize)
+{
+    size_t capacity = private_ACUtils_ADynArray_growStrategyDefault(requiredSize, typeSize);
+    size_t pageSize = private_ACUtils_ADynArray_pageSize();
+    if(typeSize == 0 || capacity > (((size_t) -1) - pageSize) / typeSize || capacity * typeSize < pageSize)
+        return capacity;
+    return (capacity * typeSize + pageSize - 1) / pageSize * pageSize / typeSize;
+}
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyOneAndAHalf(size_t requiredSize, size_t typeSize)
+{
+    size_t capacity = 8;
+    (void) typeSize; /* suppress unused warning */
+    while(capacity < requiredSize)
+        capacity = (capacity > ((size_t) -1) / 3 * 2) ? ((size_t) -1) : capacity + capacity / 2;
+    if(capacity - requiredSize > 1000000)
+        capacity = requiredSize + 1000000;
+    return capacity;
+}
+ACUTILS_HD_FUNC size_t ADynArray_growStrategySizeClass(size_t requiredSize, size_t typeSize)
+{
+    size_t size, spacing, capacity;
+    if(typeSize == 0 || requiredSize > ((size_t) -1) / typeSize)
+        return requiredSize;
+    size = requiredSize * typeSize;
+    /* multiples of 16 up to 128 bytes, above four classes per power of two (e.g. 160, 192, 224, 256, 320, ...) */
+    spacing = (size <= 128) ? 16 : private_ACUtils_ADynArray_nextPowerOfTwo(size) / 8;
+    if(size == 0)
+        size = 1;
+    if(spacing == 0 || size > ((size_t) -1) - spacing)
+        return requiredSize;
+    capacity = (size + spacing - 1) / spacing * spacing / typeSize;
+    return (capacity == 0) ? 1 : capacity;
+}
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyExact(size_t requiredSize, size_t typeSize)
+{
+    (void) typeSize; /* suppress unused warning */
+    return (requiredSize == 0) ? 1 : requiredSize;
+}
+ACUTILS_HD_FUNC size_t ADynArray_growStrategyLinearChunk(size_t requiredSize, size_t typeSize)
+{
+    size_t chunkCapacity = (typeSize == 0 || typeSize >= ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE) ? 1 : ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE / typeSize;
+    if(requiredSize == 0)
+        requiredSize = 1;
+    if(requiredSize > ((size_t) -1) - chunkCapacity)
+        return requiredSize;
+    return (requiredSize + chunkCapacity - 1) / chunkCapacity * chunkCapacity;
+}
+
 
 A_DYNAMIC_ARRAY_DEFINITION(private_ACUtils_DynArray_Prototype, char);
+A_SMALL_DYNAMIC_ARRAY_DEFINITION(private_ACUtils_SmallDynArray_Prototype, char, 1);
 
-ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_construct(size_t typeSize)
+static void* private_ACUtils_ADynArray_reallocate(struct private_ACUtils_DynArray_Prototype *prototype, void *ptr, size_t size)
 {
-    return private_ACUtils_ADynArray_constructWithAllocator(typeSize, realloc, free);
+    if(prototype->allocator.reallocator != NULL)
+        return prototype->allocator.reallocator(prototype->allocator.context, ptr, size);
+    return prototype->reallocator(ptr, size);
 }
-ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructWithAllocator(size_t typeSize, ACUtilsReallocator reallocator,
-                                                                       ACUtilsDeallocator deallocator)
+static void private_ACUtils_ADynArray_deallocate(struct private_ACUtils_DynArray_Prototype *prototype, void *ptr)
 {
-    struct private_ACUtils_DynArray_Prototype* prototype;
-    if(reallocator == NULL || deallocator == NULL)
+    if(prototype->allocator.deallocator != NULL)
+        prototype->allocator.deallocator(prototype->allocator.context, ptr);
+    else
+        prototype->deallocator(ptr);
+}
+
+/* returns the number of bytes that can be used in the allocation ptr of prototype or 0 if it is unknown */
+static size_t private_ACUtils_ADynArray_usableSize(struct private_ACUtils_DynArray_Prototype *prototype, void *ptr)
+{
+    if(prototype->allocator.reallocator != NULL)
+        return (prototype->allocator.usableSize != NULL) ? prototype->allocator.usableSize(prototype->allocator.context, ptr) : 0;
+#ifdef __GLIBC__
+    if(prototype->reallocator == realloc)
+        return malloc_usable_size(ptr);
+#endif
+    return 0;
+}
+
+/* the maximum alignment that aligned arrays accept, the offset of an aligned buffer into its allocation must fit into
+ * the unsigned char stored in front of the buffer */
+static const size_t private_ACUtils_ADynArray_alignmentMax = 128;
+
+/* aligned arrays over-allocate their buffer by alignment bytes and place it at the first aligned address behind the
+ * start of the allocation, the distance (1 to alignment) is stored in the byte in front of the buffer */
+static size_t private_ACUtils_ADynArray_bufferOffset(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer)
+{
+    if(prototype->alignment == 0 || buffer == NULL)
+        return 0;
+    return ((unsigned char*) buffer)[-1];
+}
+/* reallocates buffer (or allocates a new one if it is null) to size bytes, keeping the first usedSize bytes and the
+ * alignment of prototype */
+static char* private_ACUtils_ADynArray_reallocateBuffer(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer,
+                                                        size_t usedSize, size_t size)
+{
+    size_t offset, newOffset;
+    char *allocation;
+    if(prototype->alignment == 0)
+        return (char*) private_ACUtils_ADynArray_reallocate(prototype, buffer, size);
+    if(size > ((size_t) -1) - prototype->alignment)
         return NULL;
-    prototype = (struct private_ACUtils_DynArray_Prototype*) reallocator(NULL, sizeof(struct private_ACUtils_DynArray_Prototype));
+    offset = private_ACUtils_ADynArray_bufferOffset(prototype, buffer);
+    allocation = (char*) private_ACUtils_ADynArray_reallocate(prototype, (buffer == NULL) ? NULL : buffer - offset,
+                                                             size + prototype->alignment);
+    if(allocation == NULL)
+        return NULL;
+    newOffset = prototype->alignment - ((size_t) allocation) % prototype->alignment;
+    /* the allocator may have moved the content to an address with another misalignment */
+    if(buffer != NULL && newOffset != offset)
+        memmove(allocation + newOffset, allocation + offset, (usedSize < size) ? usedSize : size);
+    allocation[newOffset - 1] = (char) (unsigned char) newOffset;
+    return allocation + newOffset;
+}
+static void private_ACUtils_ADynArray_deallocateBuffer(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer)
+{
+    if(buffer != NULL)
+        private_ACUtils_ADynArray_deallocate(prototype, buffer - private_ACUtils_ADynArray_bufferOffset(prototype, buffer));
+}
+/* returns the number of bytes that can be used in buffer of prototype or 0 if it is unknown */
+static size_t private_ACUtils_ADynArray_bufferUsableSize(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer)
+{
+    size_t offset = private_ACUtils_ADynArray_bufferOffset(prototype, buffer);
+    size_t usableSize = private_ACUtils_ADynArray_usableSize(prototype, buffer - offset);
+    return (usableSize <= offset) ? 0 : usableSize - offset;
+}
+
+/* the buffer is not allocated on its own (e.g. placed behind the struct) and must not be reallocated or freed */
+static const unsigned int private_ACUtils_ADynArray_flagInlineBuffer = 1u;
+/* the struct has an inline buffer (A_SMALL_DYNAMIC_ARRAY_DEFINITION), which is used whenever the elements fit */
+static const unsigned int private_ACUtils_ADynArray_flagSmallBuffer = 2u;
+/* the capacity is raised to what the allocator really handed out if it is more than requested */
+static const unsigned int private_ACUtils_ADynArray_flagReclaimSlack = 4u;
+/* size of the struct rounded up, that the buffer behind it is aligned for every type */
+static const size_t private_ACUtils_ADynArray_compactHeaderSize =
+        private_ACUtils_alignUp(sizeof(struct private_ACUtils_DynArray_Prototype));
+
+/* if inlineOffset is not 0, the initial buffer of inlineCapacity elements is placed inlineOffset bytes behind the start of
+ * the struct in the same allocation of allocationSize bytes, otherwise it gets its own allocation aligned to alignment
+ * bytes (0 for the alignment of the allocator) */
+static void* private_ACUtils_ADynArray_constructGeneric(size_t typeSize, ACUtilsReallocator reallocator,
+                                                        ACUtilsDeallocator deallocator,
+                                                        const struct ACUtilsAllocator *allocator, size_t allocationSize,
+                                                        size_t inlineOffset, size_t inlineCapacity, size_t alignment)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype;
+    if(allocator != NULL)
+        prototype = (struct private_ACUtils_DynArray_Prototype*) allocator->reallocator(allocator->context, NULL, allocationSize);
+    else
+        prototype = (struct private_ACUtils_DynArray_Prototype*) reallocator(NULL, allocationSize);
     if(prototype != NULL) {
         struct private_ACUtils_DynArray_Prototype tmpPrototype = {reallocator, deallocator};
         memcpy(prototype, &tmpPrototype, sizeof(struct private_ACUtils_DynArray_Prototype));
+        if(allocator != NULL)
+            prototype->allocator = *allocator;
         prototype->growStrategy = private_ACUtils_ADynArray_growStrategyDefault;
         prototype->size = 0;
-        prototype->capacity = prototype->growStrategy(prototype->size, typeSize);
-        prototype->buffer = (char*) prototype->reallocator(NULL, prototype->capacity * typeSize);
-        if(prototype->buffer == NULL) {
-            private_ACUtils_ADynArray_destruct(prototype);
-            return NULL;
+        /* only the built-in allocator is known to align to MaxAlign, a custom one may hand out less */
+        if(allocator == NULL && reallocator == realloc && alignment <= sizeof(union private_ACUtils_MaxAlign))
+            prototype->alignment = 0;
+        else
+            prototype->alignment = alignment;
+        if(inlineOffset != 0) {
+            prototype->capacity = inlineCapacity;
+            prototype->flags |= private_ACUtils_ADynArray_flagInlineBuffer;
+            prototype->buffer = ((char*) prototype) + inlineOffset;
+        } else {
+            prototype->capacity = private_ACUtils_ADynArray_growStrategyDefault(0, typeSize);
+            prototype->buffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, NULL, 0, prototype->capacity * typeSize);
+            if(prototype->buffer == NULL) {
+                private_ACUtils_ADynArray_destruct(prototype);
+                return NULL;
+            }
         }
     }
     return prototype;
 }
+static void* private_ACUtils_ADynArray_constructCompactGeneric(size_t typeSize, ACUtilsReallocator reallocator,
+                                                               ACUtilsDeallocator deallocator,
+                                                               const struct ACUtilsAllocator *allocator)
+{
+    size_t capacity = private_ACUtils_ADynArray_growStrategyDefault(0, typeSize);
+    return private_ACUtils_ADynArray_constructGeneric(typeSize, reallocator, deallocator, allocator,
+                                                      private_ACUtils_ADynArray_compactHeaderSize + capacity * typeSize,
+                                                      private_ACUtils_ADynArray_compactHeaderSize, capacity, 0);
+}
+static void* private_ACUtils_ADynArray_constructSmallGeneric(size_t typeSize, size_t structSize, size_t smallOffset,
+                                                             size_t smallCapacity, ACUtilsReallocator reallocator,
+                                                             ACUtilsDeallocator deallocator,
+                                                             const struct ACUtilsAllocator *allocator)
+{
+    struct private_ACUtils_SmallDynArray_Prototype* prototype;
+    prototype = (struct private_ACUtils_SmallDynArray_Prototype*) private_ACUtils_ADynArray_constructGeneric(
+            typeSize, reallocator, deallocator, allocator, structSize, smallOffset, smallCapacity, 0);
+    if(prototype != NULL) {
+        prototype->flags |= private_ACUtils_ADynArray_flagSmallBuffer;
+        prototype->smallCapacity = smallCapacity;
+        prototype->smallOffset = smallOffset;
+    }
+    return prototype;
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_construct(size_t typeSize)
+{
+    return private_ACUtils_ADynArray_constructWithAllocator(typeSize, realloc, free);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructWithAllocator(size_t typeSize, ACUtilsReallocator reallocator,
+                                                                       ACUtilsDeallocator deallocator)
+{
+    if(reallocator == NULL || deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructGeneric(typeSize, reallocator, deallocator, NULL,
+                                                      sizeof(struct private_ACUtils_DynArray_Prototype), 0, 0, 0);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructWithAllocatorObject(size_t typeSize,
+                                                                             const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == NULL || allocator->reallocator == NULL || allocator->deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructGeneric(typeSize, NULL, NULL, allocator,
+                                                      sizeof(struct private_ACUtils_DynArray_Prototype), 0, 0, 0);
+}
+static bool private_ACUtils_ADynArray_isValidAlignment(size_t alignment)
+{
+    return alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= private_ACUtils_ADynArray_alignmentMax;
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructAligned(size_t typeSize, size_t alignment)
+{
+    return private_ACUtils_ADynArray_constructAlignedWithAllocator(typeSize, alignment, realloc, free);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructAlignedWithAllocator(size_t typeSize, size_t alignment,
+                                                                              ACUtilsReallocator reallocator,
+                                                                              ACUtilsDeallocator deallocator)
+{
+    if(reallocator == NULL || deallocator == NULL || !private_ACUtils_ADynArray_isValidAlignment(alignment))
+        return NULL;
+    return private_ACUtils_ADynArray_constructGeneric(typeSize, reallocator, deallocator, NULL,
+                                                      sizeof(struct private_ACUtils_DynArray_Prototype), 0, 0, alignment);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructAlignedWithAllocatorObject(size_t typeSize, size_t alignment,
+                                                                                    const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == NULL || allocator->reallocator == NULL || allocator->deallocator == NULL
+       || !private_ACUtils_ADynArray_isValidAlignment(alignment))
+        return NULL;
+    return private_ACUtils_ADynArray_constructGeneric(typeSize, NULL, NULL, allocator,
+                                                      sizeof(struct private_ACUtils_DynArray_Prototype), 0, 0, alignment);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructCompact(size_t typeSize)
+{
+    return private_ACUtils_ADynArray_constructCompactWithAllocator(typeSize, realloc, free);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructCompactWithAllocator(size_t typeSize, ACUtilsReallocator reallocator,
+                                                                              ACUtilsDeallocator deallocator)
+{
+    if(reallocator == NULL || deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructCompactGeneric(typeSize, reallocator, deallocator, NULL);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructCompactWithAllocatorObject(size_t typeSize,
+                                                                                    const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == NULL || allocator->reallocator == NULL || allocator->deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructCompactGeneric(typeSize, NULL, NULL, allocator);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructSmall(size_t typeSize, size_t structSize, size_t smallOffset,
+                                                               size_t smallCapacity)
+{
+    return private_ACUtils_ADynArray_constructSmallWithAllocator(typeSize, structSize, smallOffset, smallCapacity, realloc, free);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructSmallWithAllocator(size_t typeSize, size_t structSize,
+                                                                            size_t smallOffset, size_t smallCapacity,
+                                                                            ACUtilsReallocator reallocator,
+                                                                            ACUtilsDeallocator deallocator)
+{
+    if(reallocator == NULL || deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructSmallGeneric(typeSize, structSize, smallOffset, smallCapacity,
+                                                           reallocator, deallocator, NULL);
+}
+ACUTILS_HD_FUNC void* private_ACUtils_ADynArray_constructSmallWithAllocatorObject(size_t typeSize, size_t structSize,
+                                                                                  size_t smallOffset, size_t smallCapacity,
+                                                                                  const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == NULL || allocator->reallocator == NULL || allocator->deallocator == NULL)
+        return NULL;
+    return private_ACUtils_ADynArray_constructSmallGeneric(typeSize, structSize, smallOffset, smallCapacity,
+                                                           NULL, NULL, allocator);
+}
 ACUTILS_HD_FUNC void private_ACUtils_ADynArray_destruct(void *dynArray)
 {
     if(dynArray != NULL) {
         struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
-        prototype->deallocator(prototype->buffer);
-        prototype->deallocator(prototype);
+        if(!(prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer))
+            private_ACUtils_ADynArray_deallocateBuffer(prototype, prototype->buffer);
+        if(prototype->tombstones != NULL)
+            private_ACUtils_ADynArray_deallocate(prototype, prototype->tombstones);
+        private_ACUtils_ADynArray_deallocate(prototype, prototype);
     }
 }
 
@@ -74,6 +386,17 @@ ACUTILS_HD_FUNC void private_ACUtils_ADynArray_setGrowStrategy(void* dynArray, A
         ((struct private_ACUtils_DynArray_Prototype*) dynArray)->growStrategy = growStrategy;
 }
 
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_setReclaimSlack(void *dynArray, bool reclaimSlack)
+{
+    if(dynArray != NULL) {
+        struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+        if(reclaimSlack)
+            prototype->flags |= private_ACUtils_ADynArray_flagReclaimSlack;
+        else
+            prototype->flags &= ~private_ACUtils_ADynArray_flagReclaimSlack;
+    }
+}
+
 ACUTILS_HD_FUNC size_t private_ACUtils_ADynArray_size(const void *dynArray)
 {
     return (dynArray == NULL) ? 0 : ((struct private_ACUtils_DynArray_Prototype*) dynArray)->size;
@@ -83,19 +406,191 @@ ACUTILS_HD_FUNC size_t private_ACUtils_ADynArray_capacity(const void *dynArray)
     return (dynArray == NULL) ? 0 : ((struct private_ACUtils_DynArray_Prototype*) dynArray)->capacity;
 }
 
+/* returns the capacity the grow strategy of prototype aims at for reserveSize elements, which is less than reserveSize
+ * if the grow strategy can't provide enough elements */
+static size_t private_ACUtils_ADynArray_aimedCapacity(struct private_ACUtils_DynArray_Prototype *prototype,
+                                                      size_t reserveSize, bool forceExactSize, size_t typeSize)
+{
+    if(prototype->growStrategy != NULL && (!forceExactSize || reserveSize < prototype->growStrategy(0, typeSize)))
+        return prototype->growStrategy(reserveSize, typeSize);
+    return reserveSize;
+}
+/* makes buffer with room for capacity elements the buffer of prototype, raising the capacity if slack is reclaimed */
+static void private_ACUtils_ADynArray_setBuffer(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer,
+                                                size_t capacity, size_t typeSize)
+{
+    if(prototype->flags & private_ACUtils_ADynArray_flagReclaimSlack) {
+        size_t usableCapacity = private_ACUtils_ADynArray_bufferUsableSize(prototype, buffer) / typeSize;
+        if(usableCapacity > capacity)
+            capacity = usableCapacity;
+    }
+    prototype->capacity = capacity;
+    prototype->buffer = buffer;
+}
+/* releases the buffer of prototype (unless it is inline) and replaces it by buffer with room for capacity elements */
+static void private_ACUtils_ADynArray_replaceBuffer(struct private_ACUtils_DynArray_Prototype *prototype, char *buffer,
+                                                    size_t capacity, size_t typeSize)
+{
+    if(prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer)
+        prototype->flags &= ~private_ACUtils_ADynArray_flagInlineBuffer;
+    else
+        private_ACUtils_ADynArray_deallocateBuffer(prototype, prototype->buffer);
+    private_ACUtils_ADynArray_setBuffer(prototype, buffer, capacity, typeSize);
+}
+/* the tombstones of an array in lazy removal mode, followed by a bitmap with one bit per element (set if removed) */
+struct private_ACUtils_ADynArray_Tombstones
+{
+    unsigned int compactDivisor;
+    /* set by marking once the marked elements reach the compact ratio, marking itself never moves elements */
+    bool compactDue;
+    size_t count;
+    size_t bitmapSize;
+};
+#define private_ACUtils_ADynArray_tombstonesHeaderSize private_ACUtils_alignUp(sizeof(struct private_ACUtils_ADynArray_Tombstones))
+
+static unsigned char* private_ACUtils_ADynArray_tombstoneBits(struct private_ACUtils_ADynArray_Tombstones *tombstones)
+{
+    return ((unsigned char*) tombstones) + private_ACUtils_ADynArray_tombstonesHeaderSize;
+}
+static bool private_ACUtils_ADynArray_isTombstone(struct private_ACUtils_ADynArray_Tombstones *tombstones, size_t index)
+{
+    return index / CHAR_BIT < tombstones->bitmapSize
+           && (private_ACUtils_ADynArray_tombstoneBits(tombstones)[index / CHAR_BIT] & (1u << (index % CHAR_BIT)));
+}
+/* removes the marked elements of prototype in one pass, which moves every run of kept elements once */
+static void private_ACUtils_ADynArray_compactTombstones(struct private_ACUtils_DynArray_Prototype *prototype, size_t typeSize)
+{
+    size_t readIndex = 0, writeIndex;
+    struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    unsigned char *bits;
+    if(tombstones == NULL || tombstones->count == 0)
+        return;
+    bits = private_ACUtils_ADynArray_tombstoneBits(tombstones);
+    /* the elements in front of the first tombstone stay where they are */
+    while(bits[readIndex / CHAR_BIT] == 0)
+        readIndex += CHAR_BIT;
+    while(!private_ACUtils_ADynArray_isTombstone(tombstones, readIndex))
+        ++readIndex;
+    writeIndex = readIndex;
+    while(readIndex < prototype->size) {
+        size_t runStart;
+        if(private_ACUtils_ADynArray_isTombstone(tombstones, readIndex)) {
+            ++readIndex;
+            continue;
+        }
+        runStart = readIndex++;
+        while(readIndex < prototype->size && !private_ACUtils_ADynArray_isTombstone(tombstones, readIndex))
+            ++readIndex;
+        memmove(prototype->buffer + (writeIndex * typeSize), prototype->buffer + (runStart * typeSize), (readIndex - runStart) * typeSize);
+        writeIndex += readIndex - runStart;
+    }
+    prototype->size = writeIndex;
+    memset(bits, 0, tombstones->bitmapSize);
+    tombstones->count = 0;
+    tombstones->compactDue = false;
+}
+/* drops all tombstones without moving elements, for operations which discard the marked elements anyway */
+static void private_ACUtils_ADynArray_clearTombstones(struct private_ACUtils_DynArray_Prototype *prototype)
+{
+    struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    if(tombstones != NULL && tombstones->count > 0) {
+        memset(private_ACUtils_ADynArray_tombstoneBits(tombstones), 0, tombstones->bitmapSize);
+        tombstones->count = 0;
+        tombstones->compactDue = false;
+    }
+}
+static void private_ACUtils_ADynArray_setTombstone(struct private_ACUtils_ADynArray_Tombstones *tombstones, size_t index,
+                                                   bool removed)
+{
+    unsigned char *byte = private_ACUtils_ADynArray_tombstoneBits(tombstones) + (index / CHAR_BIT);
+    if(removed)
+        *byte |= (unsigned char) (1u << (index % CHAR_BIT));
+    else
+        *byte &= (unsigned char) ~(1u << (index % CHAR_BIT));
+}
+/* returns the number of marked elements from start to end - 1 */
+static size_t private_ACUtils_ADynArray_tombstonesBetween(struct private_ACUtils_ADynArray_Tombstones *tombstones,
+                                                          size_t start, size_t end)
+{
+    size_t count = 0;
+    for(; start < end; ++start) {
+        if(private_ACUtils_ADynArray_isTombstone(tombstones, start))
+            ++count;
+    }
+    return count;
+}
+/* grows the bitmap of prototype to cover at least elementCount elements and the capacity, returns false on failure */
+static bool private_ACUtils_ADynArray_reserveTombstones(struct private_ACUtils_DynArray_Prototype *prototype,
+                                                        size_t elementCount)
+{
+    size_t bitmapSize;
+    struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    if(elementCount <= tombstones->bitmapSize * CHAR_BIT)
+        return true;
+    /* covering the capacity lets the bitmap only grow when the buffer has grown */
+    bitmapSize = ((elementCount > prototype->capacity) ? elementCount : prototype->capacity) / CHAR_BIT + 1;
+    tombstones = (struct private_ACUtils_ADynArray_Tombstones*) private_ACUtils_ADynArray_reallocate(
+            prototype, tombstones, private_ACUtils_ADynArray_tombstonesHeaderSize + bitmapSize);
+    if(tombstones == NULL)
+        return false;
+    memset(private_ACUtils_ADynArray_tombstoneBits(tombstones) + tombstones->bitmapSize, 0, bitmapSize - tombstones->bitmapSize);
+    tombstones->bitmapSize = bitmapSize;
+    prototype->tombstones = tombstones;
+    return true;
+}
+/* marks the count elements starting at index (which are in bounds), returns false if the bitmap could not be grown */
+static bool private_ACUtils_ADynArray_markTombstones(struct private_ACUtils_DynArray_Prototype *prototype, size_t index,
+                                                     size_t count)
+{
+    size_t end = index + count;
+    struct private_ACUtils_ADynArray_Tombstones *tombstones;
+    if(!private_ACUtils_ADynArray_reserveTombstones(prototype, end))
+        return false;
+    tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    for(; index < end; ++index) {
+        if(!private_ACUtils_ADynArray_isTombstone(tombstones, index)) {
+            private_ACUtils_ADynArray_setTombstone(tombstones, index, true);
+            ++tombstones->count;
+        }
+    }
+    /* count / size >= 1 / compactDivisor, compacting here would shift the indices the caller is still marking */
+    if(tombstones->compactDivisor != 0
+       && tombstones->count >= (prototype->size + tombstones->compactDivisor - 1) / tombstones->compactDivisor)
+        tombstones->compactDue = true;
+    return true;
+}
+/* compacts prototype if it has marked elements and moves index to the kept element which was at or behind it */
+static size_t private_ACUtils_ADynArray_compactTombstonesAt(struct private_ACUtils_DynArray_Prototype *prototype, size_t index,
+                                                            size_t typeSize)
+{
+    struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    if(tombstones == NULL || tombstones->count == 0)
+        return index;
+    index -= private_ACUtils_ADynArray_tombstonesBetween(tombstones, 0, (index < prototype->size) ? index : prototype->size);
+    private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+    return index;
+}
+
 ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_reserve(void *dynArray, size_t reserveSize, bool forceExactSize, size_t typeSize)
 {
     if(dynArray != NULL) {
         struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
         if(prototype->capacity < reserveSize || prototype->buffer == NULL) {
-            size_t aimedCapacity = reserveSize;
-            if(prototype->growStrategy != NULL && (!forceExactSize || reserveSize < prototype->growStrategy(0, typeSize)))
-                aimedCapacity = prototype->growStrategy(reserveSize, typeSize);
+            size_t aimedCapacity = private_ACUtils_ADynArray_aimedCapacity(prototype, reserveSize, forceExactSize, typeSize);
             if(aimedCapacity >= reserveSize) {
-                char* tmpBuffer = (char*) prototype->reallocator(prototype->buffer, aimedCapacity * typeSize);
+                char* tmpBuffer;
+                if(prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer) {
+                    tmpBuffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, NULL, 0, aimedCapacity * typeSize);
+                    if(tmpBuffer != NULL) {
+                        memcpy(tmpBuffer, prototype->buffer, prototype->size * typeSize);
+                        prototype->flags &= ~private_ACUtils_ADynArray_flagInlineBuffer;
+                    }
+                } else {
+                    tmpBuffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, prototype->buffer, prototype->size * typeSize,
+                                                                           aimedCapacity * typeSize);
+                }
                 if(tmpBuffer != NULL) {
-                    prototype->capacity = aimedCapacity;
-                    prototype->buffer = tmpBuffer;
+                    private_ACUtils_ADynArray_setBuffer(prototype, tmpBuffer, aimedCapacity, typeSize);
                     return true;
                 }
             }
@@ -109,7 +604,20 @@ ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_shrinkToFit(void *dynArray, size_
 {
     if(dynArray != NULL) {
         struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
-        if(prototype->growStrategy != NULL) {
+        private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+        if(prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer) {
+            return true; /* the inline buffer can't be shrunk */
+        } else if((prototype->flags & private_ACUtils_ADynArray_flagSmallBuffer)
+                  && prototype->size <= ((struct private_ACUtils_SmallDynArray_Prototype*) dynArray)->smallCapacity) {
+            struct private_ACUtils_SmallDynArray_Prototype* smallPrototype = (struct private_ACUtils_SmallDynArray_Prototype*) dynArray;
+            char *smallBuffer = ((char*) smallPrototype) + smallPrototype->smallOffset;
+            memcpy(smallBuffer, prototype->buffer, prototype->size * typeSize);
+            private_ACUtils_ADynArray_deallocateBuffer(prototype, prototype->buffer);
+            prototype->buffer = smallBuffer;
+            prototype->capacity = smallPrototype->smallCapacity;
+            prototype->flags |= private_ACUtils_ADynArray_flagInlineBuffer;
+            return true;
+        } else if(prototype->growStrategy != NULL) {
             if(prototype->capacity > prototype->growStrategy(prototype->size, typeSize)) {
                 size_t capacityBackup = prototype->capacity;
                 prototype->capacity = (prototype->size == 0) ? 0 : prototype->size - 1;
@@ -126,46 +634,289 @@ ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_shrinkToFit(void *dynArray, size_
     return false;
 }
 
-ACUTILS_HD_FUNC void private_ACUtils_ADynArray_clear(void *dynArray)
+/* releases capacity if the size dropped below capacity / shrinkDivisor, the new capacity leaves room for twice the size,
+ * so the array has to double before it grows again and to halve before it shrinks again */
+static void private_ACUtils_ADynArray_applyShrinkPolicy(struct private_ACUtils_DynArray_Prototype *prototype, size_t typeSize)
+{
+    size_t targetCapacity;
+    char *tmpBuffer;
+    if(prototype->shrinkDivisor < 2 || prototype->growStrategy == NULL
+       || (prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer)
+       || prototype->size >= prototype->capacity / prototype->shrinkDivisor)
+        return;
+    if((prototype->flags & private_ACUtils_ADynArray_flagSmallBuffer)
+       && prototype->size <= ((struct private_ACUtils_SmallDynArray_Prototype*) prototype)->smallCapacity) {
+        private_ACUtils_ADynArray_shrinkToFit(prototype, typeSize);
+        return;
+    }
+    targetCapacity = prototype->growStrategy((prototype->size > ((size_t) -1) / 2) ? prototype->size : prototype->size * 2, typeSize);
+    if(targetCapacity >= prototype->capacity || targetCapacity < prototype->size || targetCapacity == 0)
+        return;
+    tmpBuffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, prototype->buffer, prototype->size * typeSize,
+                                                          targetCapacity * typeSize);
+    if(tmpBuffer != NULL) { /* on failure the bigger buffer is simply kept */
+        prototype->buffer = tmpBuffer;
+        prototype->capacity = targetCapacity;
+    }
+}
+
+/* replaces the buffer of an empty array by a zeroed one from calloc, which gets untouched zero pages from the kernel for
+ * big sizes instead of writing zeros, only possible for arrays using realloc and free */
+static bool private_ACUtils_ADynArray_reserveZeroed(struct private_ACUtils_DynArray_Prototype *prototype, size_t reserveSize,
+                                                    size_t typeSize)
+{
+    size_t aimedCapacity = reserveSize;
+    char *allocation;
+    if(prototype->allocator.reallocator != NULL || prototype->reallocator != realloc || prototype->deallocator != free
+       || (prototype->flags & private_ACUtils_ADynArray_flagInlineBuffer) || prototype->size != 0 || typeSize == 0)
+        return false;
+    if(prototype->growStrategy != NULL)
+        aimedCapacity = prototype->growStrategy(reserveSize, typeSize);
+    if(aimedCapacity < reserveSize || aimedCapacity > (((size_t) -1) - private_ACUtils_ADynArray_alignmentMax) / typeSize)
+        return false;
+    allocation = (char*) calloc(1, aimedCapacity * typeSize + prototype->alignment);
+    if(allocation == NULL)
+        return false;
+    private_ACUtils_ADynArray_deallocateBuffer(prototype, prototype->buffer);
+    if(prototype->alignment != 0) {
+        size_t offset = prototype->alignment - ((size_t) allocation) % prototype->alignment;
+        allocation[offset - 1] = (char) (unsigned char) offset;
+        allocation += offset;
+    }
+    if(prototype->flags & private_ACUtils_ADynArray_flagReclaimSlack) {
+        size_t usableCapacity = private_ACUtils_ADynArray_bufferUsableSize(prototype, allocation) / typeSize;
+        if(usableCapacity > aimedCapacity)
+            aimedCapacity = usableCapacity;
+    }
+    prototype->buffer = allocation;
+    prototype->capacity = aimedCapacity;
+    return true;
+}
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_resize(void *dynArray, size_t newSize, bool zeroFill, size_t typeSize)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL)
+        return false;
+    private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+    if(newSize <= prototype->size) {
+        prototype->size = newSize;
+        private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
+        return true;
+    }
+    if(!zeroFill || prototype->capacity >= newSize || !private_ACUtils_ADynArray_reserveZeroed(prototype, newSize, typeSize)) {
+        if(!private_ACUtils_ADynArray_reserve(dynArray, newSize, false, typeSize))
+            return false;
+        if(zeroFill)
+            memset(prototype->buffer + prototype->size * typeSize, 0, (newSize - prototype->size) * typeSize);
+    }
+    prototype->size = newSize;
+    return true;
+}
+
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_setShrinkPolicy(void *dynArray, unsigned int shrinkDivisor)
 {
     if(dynArray != NULL)
+        ((struct private_ACUtils_DynArray_Prototype*) dynArray)->shrinkDivisor = shrinkDivisor;
+}
+
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_clear(void *dynArray, size_t typeSize)
+{
+    if(dynArray != NULL) {
+        private_ACUtils_ADynArray_clearTombstones((struct private_ACUtils_DynArray_Prototype*) dynArray);
         ((struct private_ACUtils_DynArray_Prototype*) dynArray)->size = 0;
+        private_ACUtils_ADynArray_applyShrinkPolicy((struct private_ACUtils_DynArray_Prototype*) dynArray, typeSize);
+    }
 }
 ACUTILS_HD_FUNC void private_ACUtils_ADynArray_remove(void *dynArray, size_t index, size_t count, size_t typeSize)
 {
     struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
-    if(dynArray != NULL && count > 0 && index >= 0 && index < prototype->size) {
-        if(index + count <= prototype->size) {
-            memmove(prototype->buffer + (index * typeSize), prototype->buffer + ((index + count) * typeSize), (prototype->size - index - count) * typeSize);
-            prototype->size -= count;
-        } else {
-            prototype->size = index;
+    if(dynArray == NULL || count == 0 || index >= prototype->size)
+        return;
+    if(count > prototype->size - index)
+        count = prototype->size - index;
+    if(prototype->tombstones != NULL) {
+        /* with lazy removal the elements are only marked */
+        if(private_ACUtils_ADynArray_markTombstones(prototype, index, count))
+            return;
+        /* the bitmap could not be grown, so the kept elements of the range are removed from the compacted elements */
+        count -= private_ACUtils_ADynArray_tombstonesBetween((struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones,
+                                                             index, index + count);
+        index = private_ACUtils_ADynArray_compactTombstonesAt(prototype, index, typeSize);
+    }
+    memmove(prototype->buffer + (index * typeSize), prototype->buffer + ((index + count) * typeSize), (prototype->size - index - count) * typeSize);
+    prototype->size -= count;
+    private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
+}
+
+/* moves the elements of prototype to a new buffer with a gap of count elements at index, which copies every element once
+ * instead of reallocating (copying all elements) and moving the elements behind index again */
+static bool private_ACUtils_ADynArray_reallocateWithGap(struct private_ACUtils_DynArray_Prototype *prototype, size_t index,
+                                                        size_t count, size_t typeSize)
+{
+    char *tmpBuffer;
+    size_t aimedCapacity;
+    if(count > ((size_t) -1) - prototype->size)
+        return false;
+    aimedCapacity = private_ACUtils_ADynArray_aimedCapacity(prototype, prototype->size + count, false, typeSize);
+    if(aimedCapacity < prototype->size + count)
+        return false;
+    tmpBuffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, NULL, 0, aimedCapacity * typeSize);
+    if(tmpBuffer == NULL)
+        return false;
+    memcpy(tmpBuffer, prototype->buffer, index * typeSize);
+    memcpy(tmpBuffer + ((index + count) * typeSize), prototype->buffer + (index * typeSize), (prototype->size - index) * typeSize);
+    private_ACUtils_ADynArray_replaceBuffer(prototype, tmpBuffer, aimedCapacity, typeSize);
+    return true;
+}
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_swapRemove(void *dynArray, size_t index, size_t typeSize)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || index >= prototype->size)
+        return;
+    if(prototype->tombstones != NULL) {
+        /* with lazy removal the element is only marked. If the bitmap could not be grown, the element isn't marked yet
+         * and is removed from the compacted elements */
+        if(private_ACUtils_ADynArray_markTombstones(prototype, index, 1))
+            return;
+        index = private_ACUtils_ADynArray_compactTombstonesAt(prototype, index, typeSize);
+    }
+    --prototype->size;
+    if(index != prototype->size)
+        memcpy(prototype->buffer + (index * typeSize), prototype->buffer + (prototype->size * typeSize), typeSize);
+    private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
+}
+ACUTILS_HD_FUNC size_t private_ACUtils_ADynArray_removeIf(void *dynArray, ACUtilsPredicate predicate, void *context, size_t typeSize)
+{
+    size_t readIndex = 0, writeIndex = 0, removedCount;
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || predicate == NULL)
+        return 0;
+    private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+    /* every run of kept elements is moved with one memmove to the end of the kept elements before it, the element which
+     * ends a run is known to be removed, so predicate is not called for it again */
+    while(readIndex < prototype->size) {
+        size_t runStart;
+        if(predicate(prototype->buffer + (readIndex * typeSize), context)) {
+            ++readIndex;
+            continue;
         }
+        runStart = readIndex++;
+        while(readIndex < prototype->size && !predicate(prototype->buffer + (readIndex * typeSize), context))
+            ++readIndex;
+        if(writeIndex != runStart)
+            memmove(prototype->buffer + (writeIndex * typeSize), prototype->buffer + (runStart * typeSize), (readIndex - runStart) * typeSize);
+        writeIndex += readIndex - runStart;
+        ++readIndex;
     }
+    removedCount = prototype->size - writeIndex;
+    prototype->size = writeIndex;
+    if(removedCount > 0)
+        private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
+    return removedCount;
 }
 
-static bool private_ACUtils_DynArray_shiftElements(void *dynArray, size_t index, size_t count, size_t typeSize)
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_setLazyRemoval(void *dynArray, bool lazyRemoval, unsigned int compactDivisor,
+                                                             size_t typeSize)
 {
-    size_t dynArraySize = private_ACUtils_ADynArray_size(dynArray);
-    if(index >= dynArraySize) {
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL)
+        return false;
+    if(!lazyRemoval) {
+        if(prototype->tombstones != NULL) {
+            private_ACUtils_ADynArray_compact(dynArray, typeSize);
+            private_ACUtils_ADynArray_deallocate(prototype, prototype->tombstones);
+            prototype->tombstones = NULL;
+        }
         return true;
-    } else if(private_ACUtils_ADynArray_reserve(dynArray, dynArraySize + count, false, typeSize)) {
-        char *buffer = ((struct private_ACUtils_DynArray_Prototype*) dynArray)->buffer + (index * typeSize);
-        memmove(buffer + (count * typeSize), buffer, (dynArraySize - index) * typeSize);
+    }
+    if(prototype->tombstones == NULL) {
+        struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*)
+                private_ACUtils_ADynArray_reallocate(prototype, NULL, private_ACUtils_ADynArray_tombstonesHeaderSize);
+        if(tombstones == NULL)
+            return false;
+        tombstones->compactDue = false;
+        tombstones->count = 0;
+        tombstones->bitmapSize = 0;
+        prototype->tombstones = tombstones;
+    }
+    ((struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones)->compactDivisor = compactDivisor;
+    return true;
+}
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_markRemoved(void *dynArray, size_t index, size_t typeSize)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || index >= prototype->size)
+        return false;
+    if(prototype->tombstones == NULL) {
+        private_ACUtils_ADynArray_remove(dynArray, index, 1, typeSize);
         return true;
     }
-    return false;
+    return private_ACUtils_ADynArray_markTombstones(prototype, index, 1);
+}
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_isRemoved(const void *dynArray, size_t index)
+{
+    const struct private_ACUtils_DynArray_Prototype* prototype = (const struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || prototype->tombstones == NULL)
+        return false;
+    return private_ACUtils_ADynArray_isTombstone((struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones, index);
+}
+ACUTILS_HD_FUNC size_t private_ACUtils_ADynArray_removedCount(const void *dynArray)
+{
+    const struct private_ACUtils_DynArray_Prototype* prototype = (const struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || prototype->tombstones == NULL)
+        return 0;
+    return ((struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones)->count;
+}
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_compact(void *dynArray, size_t typeSize)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray != NULL && prototype->tombstones != NULL
+       && ((struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones)->count > 0) {
+        private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+        private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
+    }
+}
+
+static bool private_ACUtils_DynArray_shiftElements(void *dynArray, size_t index, size_t count, size_t typeSize)
+{
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    char *buffer;
+    if(index >= prototype->size)
+        return true;
+    if(prototype->capacity - prototype->size < count)
+        return private_ACUtils_ADynArray_reallocateWithGap(prototype, index, count, typeSize);
+    buffer = prototype->buffer + (index * typeSize);
+    memmove(buffer + (count * typeSize), buffer, (prototype->size - index) * typeSize);
+    return true;
 }
 ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_prepareInsertion(void* dynArray, size_t index, size_t valueCount, size_t typeSize)
 {
     if(dynArray != NULL && valueCount > 0) {
         struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+        struct private_ACUtils_ADynArray_Tombstones *tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+        bool shiftTombstones = tombstones != NULL && tombstones->count > 0 && index < prototype->size;
+        /* appending keeps the indices of the marked elements valid, so it only compacts once compacting is due */
+        if(tombstones != NULL && tombstones->compactDue && index >= prototype->size)
+            private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+        /* inserting in front of marked elements moves their marks along, the bitmap is grown first so a failure leaves
+         * dynArray unchanged */
+        if(shiftTombstones && (valueCount > ((size_t) -1) - prototype->size
+                               || !private_ACUtils_ADynArray_reserveTombstones(prototype, prototype->size + valueCount)))
+            return false;
         if(index >= prototype->size) {
             if(!private_ACUtils_ADynArray_reserve(dynArray, prototype->size + valueCount, false, typeSize))
                 return false;
         } else if(!private_ACUtils_DynArray_shiftElements(dynArray, index, valueCount, typeSize)) {
             return false;
         }
+        if(shiftTombstones) {
+            size_t i;
+            tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+            for(i = prototype->size; i-- > index;)
+                private_ACUtils_ADynArray_setTombstone(tombstones, i + valueCount, private_ACUtils_ADynArray_isTombstone(tombstones, i));
+            for(i = index; i < index + valueCount; ++i)
+                private_ACUtils_ADynArray_setTombstone(tombstones, i, false);
+        }
         prototype->size += valueCount;
         return true;
     }
@@ -182,11 +933,152 @@ ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_insertArray(void *dynArray, size_
     }
     return false;
 }
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_appendGenerate(void *dynArray, size_t count, ACUtilsGenerator generator,
+                                                            void *context, size_t typeSize)
+{
+    size_t generated;
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || generator == NULL || !private_ACUtils_ADynArray_prepareInsertion(dynArray, -1, count, typeSize))
+        return false;
+    if(count > 0) {
+        generated = generator(prototype->buffer + ((prototype->size - count) * typeSize), count, context);
+        if(generated < count)
+            prototype->size -= count - generated;
+    }
+    return true;
+}
 
+/* checks that edits are sorted, don't overlap and stay inside an array of size elements and stores the size after
+ * applying them in editedSize */
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_editedSize(size_t size, const struct ACUtilsEdit *edits, size_t editCount,
+                                                         size_t *editedSize)
+{
+    size_t i, keptEnd = 0;
+    *editedSize = size;
+    for(i = 0; i < editCount; ++i) {
+        if(edits[i].index < keptEnd || edits[i].index > size || edits[i].removeCount > size - edits[i].index
+           || (edits[i].insertData == NULL && edits[i].insertCount > 0))
+            return false;
+        keptEnd = edits[i].index + edits[i].removeCount;
+        *editedSize -= edits[i].removeCount;
+        if(edits[i].insertCount > ((size_t) -1) - *editedSize)
+            return false;
+        *editedSize += edits[i].insertCount;
+    }
+    return true;
+}
+/* moves the kept elements of the segments first to last - 1 back to front, segment m lies between edit m - 1 and edit m
+ * and destEnd is the end of the target of segment last - 1 */
+static void private_ACUtils_ADynArray_moveKeptBackward(char *dest, const char *src, size_t size,
+                                                       const struct ACUtilsEdit *edits, size_t editCount, size_t first,
+                                                       size_t last, size_t destEnd, size_t typeSize)
+{
+    while(last > first) {
+        size_t segment = --last;
+        size_t keptEnd = (segment == editCount) ? size : edits[segment].index;
+        size_t keptStart = (segment == 0) ? 0 : edits[segment - 1].index + edits[segment - 1].removeCount;
+        destEnd -= keptEnd - keptStart;
+        memmove(dest + destEnd * typeSize, src + keptStart * typeSize, (keptEnd - keptStart) * typeSize);
+        if(segment > 0)
+            destEnd -= edits[segment - 1].insertCount;
+    }
+}
+/* moves the elements of src (size elements) which are kept by the validated edits to their position in dest and copies
+ * the inserted elements between them. dest may be src, every element is still moved only once: segments which move to
+ * the left are moved front to back, runs of segments which move to the right are moved back to front as soon as the run
+ * ends (their targets end before the next segment starts). The inserted elements are copied last, when nothing
+ * unmoved can be overwritten anymore. */
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_applyEditsToBuffer(char *dest, char *src, size_t size,
+                                                                  const struct ACUtilsEdit *edits, size_t editCount,
+                                                                  size_t typeSize)
+{
+    size_t i, runStart = 0, keptStart = 0, destStart = 0;
+    for(i = 0; i <= editCount; ++i) {
+        size_t keptEnd = (i == editCount) ? size : edits[i].index;
+        if(destStart <= keptStart) {
+            if(runStart < i)
+                private_ACUtils_ADynArray_moveKeptBackward(dest, src, size, edits, editCount, runStart, i,
+                                                           destStart - edits[i - 1].insertCount, typeSize);
+            memmove(dest + destStart * typeSize, src + keptStart * typeSize, (keptEnd - keptStart) * typeSize);
+            runStart = i + 1;
+        }
+        destStart += keptEnd - keptStart;
+        if(i < editCount) {
+            destStart += edits[i].insertCount;
+            keptStart = edits[i].index + edits[i].removeCount;
+        }
+    }
+    if(runStart <= editCount)
+        private_ACUtils_ADynArray_moveKeptBackward(dest, src, size, edits, editCount, runStart, editCount + 1, destStart, typeSize);
+    for(i = 0, destStart = 0, keptStart = 0; i < editCount; ++i) {
+        destStart += edits[i].index - keptStart;
+        if(edits[i].insertCount > 0)
+            memcpy(dest + destStart * typeSize, edits[i].insertData, edits[i].insertCount * typeSize);
+        destStart += edits[i].insertCount;
+        keptStart = edits[i].index + edits[i].removeCount;
+    }
+}
+
+/* once the filled part of the destination reaches this size, it is copied in pieces of this size (rounded to whole
+ * elements) instead of doubling further, that the source of the copies stays in the cache */
+static const size_t private_ACUtils_ADynArray_fillBlockSize = 4096;
+
+ACUTILS_HD_FUNC void private_ACUtils_ADynArray_fill(void *dest, const void *value, size_t count, size_t typeSize)
+{
+    union
+    {
+        union private_ACUtils_MaxAlign align;
+        unsigned char bytes[16];
+    } pattern;
+    char *buffer = (char*) dest;
+    size_t i, filledSize, totalSize;
+    if(count == 0 || typeSize == 0)
+        return;
+    /* elements whose bytes are all the same (e.g. 0 or -1) are a byte pattern */
+    for(i = 1; i < typeSize && ((const unsigned char*) value)[i] == ((const unsigned char*) value)[0]; ++i);
+    if(i == typeSize) {
+        memset(buffer, ((const unsigned char*) value)[0], count * typeSize);
+        return;
+    }
+    /* copying the element from a local with a constant size compiles to plain (and vectorized) stores, the copy also
+     * keeps value valid if it points into the filled range */
+    if(typeSize <= sizeof(pattern.bytes))
+        memcpy(pattern.bytes, value, typeSize);
+    switch(typeSize) {
+        case 2:
+            for(i = 0; i < count; ++i)
+                memcpy(buffer + i * 2, pattern.bytes, 2);
+            return;
+        case 4:
+            for(i = 0; i < count; ++i)
+                memcpy(buffer + i * 4, pattern.bytes, 4);
+            return;
+        case 8:
+            for(i = 0; i < count; ++i)
+                memcpy(buffer + i * 8, pattern.bytes, 8);
+            return;
+        case 16:
+            for(i = 0; i < count; ++i)
+                memcpy(buffer + i * 16, pattern.bytes, 16);
+            return;
+    }
+    /* other sizes double the filled part with every copy until it reaches the block size */
+    memmove(buffer, value, typeSize);
+    filledSize = typeSize;
+    totalSize = count * typeSize;
+    while(filledSize < totalSize && filledSize < private_ACUtils_ADynArray_fillBlockSize) {
+        size_t copySize = (filledSize < totalSize - filledSize) ? filledSize : totalSize - filledSize;
+        memcpy(buffer + filledSize, buffer, copySize);
+        filledSize += copySize;
+    }
+    for(i = filledSize; i < totalSize; i += filledSize)
+        memcpy(buffer + i, buffer, (filledSize < totalSize - i) ? filledSize : totalSize - i);
+}
 ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_setRange(void *dynArray, size_t index, size_t count, void *value, size_t typeSize)
 {
-    size_t appendCount = 0, i;
+    size_t appendCount = 0;
     struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    struct private_ACUtils_ADynArray_Tombstones *tombstones;
     if(dynArray == NULL)
         return false;
     if(index > prototype->size)
@@ -195,10 +1087,86 @@ ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_setRange(void *dynArray, size_t i
         appendCount = index + count - prototype->size;
     if(!private_ACUtils_ADynArray_reserve(dynArray, prototype->size + appendCount, false, typeSize))
         return false;
+    /* the marked elements which are overwritten are kept again */
+    tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    if(tombstones != NULL && tombstones->count > 0) {
+        size_t i;
+        for(i = index; i < prototype->size && i < index + count; ++i) {
+            if(private_ACUtils_ADynArray_isTombstone(tombstones, i)) {
+                private_ACUtils_ADynArray_setTombstone(tombstones, i, false);
+                --tombstones->count;
+            }
+        }
+    }
     prototype->size += appendCount;
-    for(i = 0; i < count; ++i)
-        memcpy(prototype->buffer + ((index + i) * typeSize), value, typeSize);
+    private_ACUtils_ADynArray_fill(prototype->buffer + (index * typeSize), value, count, typeSize);
+    return true;
+}
+
+/* applies the validated edits to prototype, which has no marked elements */
+static bool private_ACUtils_ADynArray_applyValidatedEdits(struct private_ACUtils_DynArray_Prototype *prototype,
+                                                          const struct ACUtilsEdit *edits, size_t editCount,
+                                                          size_t editedSize, size_t typeSize)
+{
+    if(editedSize > prototype->capacity) {
+        /* build the result in the new buffer instead of reallocating and moving the elements again */
+        char *tmpBuffer;
+        size_t aimedCapacity = private_ACUtils_ADynArray_aimedCapacity(prototype, editedSize, false, typeSize);
+        if(aimedCapacity < editedSize)
+            return false;
+        tmpBuffer = private_ACUtils_ADynArray_reallocateBuffer(prototype, NULL, 0, aimedCapacity * typeSize);
+        if(tmpBuffer == NULL)
+            return false;
+        private_ACUtils_ADynArray_applyEditsToBuffer(tmpBuffer, prototype->buffer, prototype->size, edits, editCount, typeSize);
+        private_ACUtils_ADynArray_replaceBuffer(prototype, tmpBuffer, aimedCapacity, typeSize);
+    } else if(editCount > 0) {
+        private_ACUtils_ADynArray_applyEditsToBuffer(prototype->buffer, prototype->buffer, prototype->size, edits, editCount, typeSize);
+    }
+    prototype->size = editedSize;
+    private_ACUtils_ADynArray_applyShrinkPolicy(prototype, typeSize);
     return true;
 }
+ACUTILS_HD_FUNC bool private_ACUtils_ADynArray_applyEdits(void *dynArray, const struct ACUtilsEdit *edits, size_t editCount,
+                                                          size_t typeSize)
+{
+    size_t i, editedSize, scanIndex = 0, removedInFront = 0, removedInside = 0;
+    bool result;
+    struct ACUtilsEdit *compactedEdits;
+    struct private_ACUtils_ADynArray_Tombstones *tombstones;
+    struct private_ACUtils_DynArray_Prototype* prototype = (struct private_ACUtils_DynArray_Prototype*) dynArray;
+    if(dynArray == NULL || (edits == NULL && editCount > 0))
+        return false;
+    if(!private_ACUtils_ADynArray_editedSize(prototype->size, edits, editCount, &editedSize))
+        return false;
+    tombstones = (struct private_ACUtils_ADynArray_Tombstones*) prototype->tombstones;
+    if(tombstones == NULL || tombstones->count == 0 || editCount == 0) {
+        if(tombstones != NULL)
+            editedSize -= tombstones->count;
+        private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+        return private_ACUtils_ADynArray_applyValidatedEdits(prototype, edits, editCount, editedSize, typeSize);
+    }
+    /* the edits refer to the marked elements as well, so they are moved to the kept elements (one pass over the marks as
+     * the edits are sorted) before dynArray is compacted, marked elements inside a removed range are not removed twice */
+    compactedEdits = (struct ACUtilsEdit*) private_ACUtils_ADynArray_reallocate(prototype, NULL, editCount * sizeof(struct ACUtilsEdit));
+    if(compactedEdits == NULL)
+        return false;
+    for(i = 0; i < editCount; ++i) {
+        size_t removedByEdit;
+        removedInFront += private_ACUtils_ADynArray_tombstonesBetween(tombstones, scanIndex, edits[i].index);
+        scanIndex = edits[i].index + edits[i].removeCount;
+        removedByEdit = private_ACUtils_ADynArray_tombstonesBetween(tombstones, edits[i].index, scanIndex);
+        compactedEdits[i] = edits[i];
+        compactedEdits[i].index -= removedInFront;
+        compactedEdits[i].removeCount -= removedByEdit;
+        removedInFront += removedByEdit;
+        removedInside += removedByEdit;
+    }
+    /* the marked elements outside of the removed ranges are removed by compacting */
+    editedSize -= tombstones->count - removedInside;
+    private_ACUtils_ADynArray_compactTombstones(prototype, typeSize);
+    result = private_ACUtils_ADynArray_applyValidatedEdits(prototype, compactedEdits, editCount, editedSize, typeSize);
+    private_ACUtils_ADynArray_deallocate(prototype, compactedEdits);
+    return result;
+}
 
 #endif /* ACUTILS_ADYNARRAY_H */
@@ -0,0 +1,176 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE /* for mremap, has no effect if system headers were already included (one source build) */
+#endif
+
+#ifndef ACUTILS_ONE_SOURCE
+#   include "../include/ACUtils/apageallocator.h"
+#endif
+
+#ifdef ACUTILS_APAGEALLOCATOR_H /* if compiled as one source and not included from header, the definitions are excluded */
+
+#include <stdlib.h>
+#include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#   include <sys/mman.h>
+#endif
+
+#include "../include/ACUtils/internal.h"
+#if defined(MAP_ANONYMOUS) && defined(MAP_FAILED)
+#   define ACUTILS_APAGEALLOCATOR_USE_MMAP
+#endif
+
+/* every allocation is prefixed with its requested size and the size of its mapping (0 if it comes from malloc) */
+struct private_ACUtils_APageAllocator_Header
+{
+    size_t size;
+    size_t mappedSize;
+};
+
+#define private_ACUtils_APageAllocator_headerSize private_ACUtils_alignUp(sizeof(struct private_ACUtils_APageAllocator_Header))
+
+static struct private_ACUtils_APageAllocator_Header* private_ACUtils_APageAllocator_header(void *ptr)
+{
+    return (struct private_ACUtils_APageAllocator_Header*) (((char*) ptr) - private_ACUtils_APageAllocator_headerSize);
+}
+static void* private_ACUtils_APageAllocator_data(struct private_ACUtils_APageAllocator_Header *header)
+{
+    return ((char*) header) + private_ACUtils_APageAllocator_headerSize;
+}
+
+#ifdef ACUTILS_APAGEALLOCATOR_USE_MMAP
+/* the page size of the system unless it is overridden */
+static size_t private_ACUtils_APageAllocator_pageSize(void)
+{
+#ifdef ACUTILS_APAGEALLOCATOR_PAGE_SIZE
+    return ACUTILS_APAGEALLOCATOR_PAGE_SIZE;
+#else
+    return private_ACUtils_systemPageSize();
+#endif
+}
+static size_t private_ACUtils_APageAllocator_roundToPages(size_t size)
+{
+    size_t pageSize = private_ACUtils_APageAllocator_pageSize();
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+static void private_ACUtils_APageAllocator_adviseHugePages(void *mapping, size_t mappedSize)
+{
+#ifdef MADV_HUGEPAGE
+    madvise(mapping, mappedSize, MADV_HUGEPAGE); /* only a hint, failure (e.g. no THP support) is irrelevant */
+#else
+    (void) mapping; /* suppress unused warning */
+    (void) mappedSize;
+#endif
+}
+static struct private_ACUtils_APageAllocator_Header* private_ACUtils_APageAllocator_map(size_t mappedSize)
+{
+    void *mapping = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mapping == MAP_FAILED)
+        return NULL;
+    private_ACUtils_APageAllocator_adviseHugePages(mapping, mappedSize);
+    ((struct private_ACUtils_APageAllocator_Header*) mapping)->mappedSize = mappedSize;
+    return (struct private_ACUtils_APageAllocator_Header*) mapping;
+}
+/* resizes the mapping of header to mappedSize bytes, moving it if necessary */
+static struct private_ACUtils_APageAllocator_Header* private_ACUtils_APageAllocator_remap(
+        struct private_ACUtils_APageAllocator_Header *header, size_t mappedSize)
+{
+    struct private_ACUtils_APageAllocator_Header *newHeader;
+#ifdef MREMAP_MAYMOVE
+    void *mapping = mremap(header, header->mappedSize, mappedSize, MREMAP_MAYMOVE);
+    if(mapping == MAP_FAILED)
+        return NULL;
+    newHeader = (struct private_ACUtils_APageAllocator_Header*) mapping;
+    if(mappedSize > newHeader->mappedSize)
+        private_ACUtils_APageAllocator_adviseHugePages(mapping, mappedSize);
+    newHeader->mappedSize = mappedSize;
+#else
+    if(mappedSize < header->mappedSize) {
+        munmap(((char*) header) + mappedSize, header->mappedSize - mappedSize);
+        header->mappedSize = mappedSize;
+        return header;
+    }
+    newHeader = private_ACUtils_APageAllocator_map(mappedSize);
+    if(newHeader == NULL)
+        return NULL;
+    memcpy(private_ACUtils_APageAllocator_data(newHeader), private_ACUtils_APageAllocator_data(header), header->size);
+    munmap(header, header->mappedSize);
+#endif
+    return newHeader;
+}
+#endif
+
+ACUTILS_HD_FUNC struct ACUtilsAllocator APageAllocator_allocator(void)
+{
+    struct ACUtilsAllocator allocator = {APageAllocator_reallocate, APageAllocator_deallocate, NULL, APageAllocator_usableSize};
+    return allocator;
+}
+
+ACUTILS_HD_FUNC void* APageAllocator_reallocate(void *context, void *ptr, size_t size)
+{
+    struct private_ACUtils_APageAllocator_Header *header = (ptr == NULL) ? NULL : private_ACUtils_APageAllocator_header(ptr);
+    size_t totalSize = private_ACUtils_APageAllocator_headerSize + size;
+    (void) context; /* suppress unused warning */
+#ifdef ACUTILS_APAGEALLOCATOR_USE_MMAP
+    if(size > ((size_t) -1) - private_ACUtils_APageAllocator_headerSize - private_ACUtils_APageAllocator_pageSize())
+#else
+    if(size > ((size_t) -1) - private_ACUtils_APageAllocator_headerSize)
+#endif
+        return NULL;
+#ifdef ACUTILS_APAGEALLOCATOR_USE_MMAP
+    if(header != NULL && header->mappedSize != 0) {
+        size_t mappedSize = private_ACUtils_APageAllocator_roundToPages(totalSize);
+        if(mappedSize != header->mappedSize) {
+            header = private_ACUtils_APageAllocator_remap(header, mappedSize);
+            if(header == NULL)
+                return NULL;
+        }
+        header->size = size;
+        return private_ACUtils_APageAllocator_data(header);
+    } else if(totalSize >= ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD) {
+        struct private_ACUtils_APageAllocator_Header *newHeader =
+                private_ACUtils_APageAllocator_map(private_ACUtils_APageAllocator_roundToPages(totalSize));
+        if(newHeader == NULL)
+            return NULL;
+        if(header != NULL) {
+            memcpy(private_ACUtils_APageAllocator_data(newHeader), ptr, header->size);
+            free(header);
+        }
+        newHeader->size = size;
+        return private_ACUtils_APageAllocator_data(newHeader);
+    }
+#endif
+    header = (struct private_ACUtils_APageAllocator_Header*) realloc(header, totalSize);
+    if(header == NULL)
+        return NULL;
+    header->size = size;
+    header->mappedSize = 0;
+    return private_ACUtils_APageAllocator_data(header);
+}
+ACUTILS_HD_FUNC void APageAllocator_deallocate(void *context, void *ptr)
+{
+    struct private_ACUtils_APageAllocator_Header *header;
+    (void) context; /* suppress unused warning */
+    if(ptr == NULL)
+        return;
+    header = private_ACUtils_APageAllocator_header(ptr);
+#ifdef ACUTILS_APAGEALLOCATOR_USE_MMAP
+    if(header->mappedSize != 0) {
+        munmap(header, header->mappedSize);
+        return;
+    }
+#endif
+    free(header);
+}
+ACUTILS_HD_FUNC size_t APageAllocator_usableSize(void *context, void *ptr)
+{
+    struct private_ACUtils_APageAllocator_Header *header;
+    (void) context; /* suppress unused warning */
+    if(ptr == NULL)
+        return 0;
+    header = private_ACUtils_APageAllocator_header(ptr);
+    if(header->mappedSize != 0)
+        return header->mappedSize - private_ACUtils_APageAllocator_headerSize;
+    return header->size;
+}
+
+#endif /* ACUTILS_APAGEALLOCATOR_H */
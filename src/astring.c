@@ -6,7 +6,12 @@
 
 #include "stdlib.h"
 #include "string.h"
-#include "math.h"
+#include "limits.h"
+#ifdef __GLIBC__
+#   include <malloc.h>
+#endif
+
+#include "../include/ACUtils/internal.h"
 
 struct AString
 {
@@ -15,12 +20,35 @@ struct AString
     size_t size;
     size_t capacity;
     char *buffer;
+    struct ACUtilsAllocator allocator;
+    unsigned int flags;
+    ACUtilsGrowStrategy growStrategy;
 };
 
 static const size_t private_ACUtils_AString_capacityMin = 8;
 static const size_t private_ACUtils_AString_capacityMul = 2;
 static const size_t private_ACUtils_AString_capacityAllocMax = 1024;
 
+#ifndef ACUTILS_ASTRING_SMALL_CAPACITY
+#   define ACUTILS_ASTRING_SMALL_CAPACITY 23
+#endif
+static const size_t private_ACUtils_AString_smallCapacity = ACUTILS_ASTRING_SMALL_CAPACITY;
+
+/* the buffer is not allocated on its own (e.g. placed behind the struct) and must not be reallocated or freed */
+static const unsigned int private_ACUtils_AString_flagInlineBuffer = 1u;
+/* behind the struct is room for private_ACUtils_AString_smallCapacity chars, which is used whenever the content fits */
+static const unsigned int private_ACUtils_AString_flagSmallBuffer = 2u;
+/* the struct lives in storage of the caller and is not freed on destruction */
+static const unsigned int private_ACUtils_AString_flagBorrowedStruct = 4u;
+/* the buffer may not be written (e.g. a string literal), it is copied to an own allocation before the first change */
+static const unsigned int private_ACUtils_AString_flagReadOnlyBuffer = 8u;
+/* the capacity is raised to what the allocator really handed out if it is more than requested */
+static const unsigned int private_ACUtils_AString_flagReclaimSlack = 16u;
+
+/* compilation fails if ACUTILS_ASTRING_STRUCT_STORAGE_SIZE cannot hold the struct at any alignment of the storage */
+typedef char private_ACUtils_AString_structStorageSizeCheck[
+        (sizeof(struct AString) + sizeof(union private_ACUtils_MaxAlign) - 1 <= ACUTILS_ASTRING_STRUCT_STORAGE_SIZE) ? 1 : -1];
+
 ACUTILS_HD_FUNC struct AString* AString_construct(void)
 {
     return AString_constructWithAllocator(realloc, free);
@@ -29,6 +57,179 @@ ACUTILS_HD_FUNC struct AString* AString_constructFromCString(const char *cstr, s
 {
     return AString_constructFromCStringWithAllocator(cstr, len, realloc, free);
 }
+static void* private_ACUtils_AString_reallocate(const struct AString *str, void *ptr, size_t size)
+{
+    if(str->allocator.reallocator != nullptr)
+        return str->allocator.reallocator(str->allocator.context, ptr, size);
+    return str->reallocator(ptr, size);
+}
+static void private_ACUtils_AString_deallocate(const struct AString *str, void *ptr)
+{
+    if(str->allocator.deallocator != nullptr)
+        str->allocator.deallocator(str->allocator.context, ptr);
+    else
+        str->deallocator(ptr);
+}
+/* returns the number of bytes that can be used in the allocation ptr of str or 0 if it is unknown */
+static size_t private_ACUtils_AString_usableSize(const struct AString *str, void *ptr)
+{
+    if(str->allocator.reallocator != nullptr)
+        return (str->allocator.usableSize != nullptr) ? str->allocator.usableSize(str->allocator.context, ptr) : 0;
+#ifdef __GLIBC__
+    if(str->reallocator == realloc)
+        return malloc_usable_size(ptr);
+#endif
+    return 0;
+}
+
+/* makes buffer with room for capacity chars (without '\0') the buffer of str, raising the capacity if slack is reclaimed */
+static void private_ACUtils_AString_setBuffer(struct AString *str, char *buffer, size_t capacity)
+{
+    if(str->flags & private_ACUtils_AString_flagReclaimSlack) {
+        size_t usableCapacity = private_ACUtils_AString_usableSize(str, buffer) / sizeof(char);
+        if(usableCapacity > capacity + 1)
+            capacity = usableCapacity - 1; /* -1 for '\0' */
+    }
+    str->capacity = capacity;
+    str->buffer = buffer;
+}
+/* releases the buffer of str (unless it is inline or read only) and replaces it by buffer with room for capacity chars */
+static void private_ACUtils_AString_replaceBuffer(struct AString *str, char *buffer, size_t capacity)
+{
+    if(!(str->flags & (private_ACUtils_AString_flagInlineBuffer | private_ACUtils_AString_flagReadOnlyBuffer)))
+        private_ACUtils_AString_deallocate(str, str->buffer);
+    str->flags &= ~(private_ACUtils_AString_flagInlineBuffer | private_ACUtils_AString_flagReadOnlyBuffer);
+    private_ACUtils_AString_setBuffer(str, buffer, capacity);
+}
+/* reallocates the buffer of str to hold capacity chars (+1 for '\0'), an inline buffer is moved to its own allocation */
+static bool private_ACUtils_AString_reallocateBuffer(struct AString *str, size_t capacity)
+{
+    char *tmpBuffer;
+    if(capacity == ((size_t) -1)) /* the '\0' wouldn't fit, the size would wrap to 0 and free the buffer */
+        return false;
+    if(str->flags & private_ACUtils_AString_flagInlineBuffer) {
+        tmpBuffer = (char*) private_ACUtils_AString_reallocate(str, nullptr, (capacity + 1) * sizeof(char));
+        if(tmpBuffer == nullptr)
+            return false;
+        memcpy(tmpBuffer, str->buffer, (str->size + 1) * sizeof(char));
+        str->flags &= ~private_ACUtils_AString_flagInlineBuffer;
+    } else {
+        tmpBuffer = (char*) private_ACUtils_AString_reallocate(str, str->buffer, (capacity + 1) * sizeof(char));
+        if(tmpBuffer == nullptr)
+            return false;
+    }
+    private_ACUtils_AString_setBuffer(str, tmpBuffer, capacity);
+    return true;
+}
+
+/* copies a read only buffer to an own allocation, so it can be changed in place */
+static bool private_ACUtils_AString_makeWritable(struct AString *str)
+{
+    if(!(str->flags & private_ACUtils_AString_flagReadOnlyBuffer))
+        return true;
+    if(!private_ACUtils_AString_reallocateBuffer(str, (str->capacity < private_ACUtils_AString_capacityMin)
+                                                      ? private_ACUtils_AString_capacityMin : str->capacity))
+        return false;
+    str->flags &= ~private_ACUtils_AString_flagReadOnlyBuffer;
+    return true;
+}
+
+/* layoutFlags may contain private_ACUtils_AString_flagInlineBuffer to place a buffer of capacity behind the struct or
+ * private_ACUtils_AString_flagSmallBuffer to place a small buffer behind the struct, which is used if capacity fits */
+static struct AString* private_ACUtils_AString_constructGeneric(size_t capacity, ACUtilsReallocator reallocator,
+                                                                ACUtilsDeallocator deallocator,
+                                                                const struct ACUtilsAllocator *allocator,
+                                                                unsigned int layoutFlags)
+{
+    struct AString *string;
+    size_t allocationSize = sizeof(struct AString);
+    if(capacity < private_ACUtils_AString_capacityMin)
+        capacity = private_ACUtils_AString_capacityMin;
+    if(layoutFlags & private_ACUtils_AString_flagSmallBuffer) {
+        allocationSize += (private_ACUtils_AString_smallCapacity + 1) * sizeof(char);
+        if(capacity <= private_ACUtils_AString_smallCapacity) {
+            capacity = private_ACUtils_AString_smallCapacity;
+            layoutFlags |= private_ACUtils_AString_flagInlineBuffer;
+        } else {
+            layoutFlags &= ~private_ACUtils_AString_flagInlineBuffer;
+        }
+    } else if(layoutFlags & private_ACUtils_AString_flagInlineBuffer) {
+        allocationSize += (capacity + 1) * sizeof(char);
+    }
+    if(allocator != nullptr)
+        string = (struct AString*) allocator->reallocator(allocator->context, nullptr, allocationSize);
+    else
+        string = (struct AString*) reallocator(nullptr, allocationSize);
+    if(string != nullptr) {
+        struct AString tmpString = { reallocator, deallocator};
+        memcpy(string, &tmpString, sizeof(struct AString));
+        if(allocator != nullptr)
+            string->allocator = *allocator;
+        string->size = 0;
+        string->capacity = capacity;
+        string->flags = layoutFlags;
+        if(layoutFlags & private_ACUtils_AString_flagInlineBuffer) {
+            string->buffer = (char*) (string + 1);
+        } else {
+            string->buffer = (char*) private_ACUtils_AString_reallocate(string, nullptr, (string->capacity + 1) * sizeof(char));
+            if(string->buffer == nullptr) {
+                AString_destruct(string);
+                return nullptr;
+            }
+        }
+        string->buffer[0] = '\0';
+    }
+    return string;
+}
+/* places the struct at the first suitably aligned address of storage, returns nullptr if storageSize is too small for
+ * the struct and minBufferSize chars behind it, otherwise *bufferSize is set to the number of chars behind the struct */
+static struct AString* private_ACUtils_AString_constructInStorage(void *storage, size_t storageSize, size_t minBufferSize,
+                                                                  size_t *bufferSize,
+                                                                  ACUtilsReallocator reallocator,
+                                                                  ACUtilsDeallocator deallocator)
+{
+    struct AString *string;
+    size_t alignment = sizeof(union private_ACUtils_MaxAlign);
+    size_t padding;
+    if(storage == nullptr || reallocator == nullptr || deallocator == nullptr)
+        return nullptr;
+    padding = (alignment - ((size_t) storage) % alignment) % alignment;
+    if(storageSize < padding + sizeof(struct AString) + minBufferSize)
+        return nullptr;
+    string = (struct AString*) (((char*) storage) + padding);
+    {
+        struct AString tmpString = { reallocator, deallocator};
+        memcpy(string, &tmpString, sizeof(struct AString));
+    }
+    string->flags = private_ACUtils_AString_flagBorrowedStruct | private_ACUtils_AString_flagInlineBuffer;
+    *bufferSize = storageSize - padding - sizeof(struct AString);
+    return string;
+}
+/* constructs an empty string with the same allocator, grow strategy and small string mode as str */
+static struct AString* private_ACUtils_AString_constructWithAllocatorOf(size_t capacity, const struct AString *str)
+{
+    struct AString *string;
+    const struct ACUtilsAllocator *allocator = (str->allocator.reallocator != nullptr) ? &str->allocator : nullptr;
+    string = private_ACUtils_AString_constructGeneric(capacity, str->reallocator, str->deallocator, allocator,
+                                                      str->flags & private_ACUtils_AString_flagSmallBuffer);
+    if(string != nullptr)
+        string->growStrategy = str->growStrategy;
+    return string;
+}
+static struct AString* private_ACUtils_AString_constructFromCStringGeneric(const char *cstr, size_t len,
+                                                                           ACUtilsReallocator reallocator,
+                                                                           ACUtilsDeallocator deallocator,
+                                                                           const struct ACUtilsAllocator *allocator,
+                                                                           unsigned int layoutFlags)
+{
+    struct AString *string;
+    string = private_ACUtils_AString_constructGeneric(len, reallocator, deallocator, allocator, layoutFlags);
+    if(AString_appendCString(string, cstr, len))
+        return string;
+    AString_destruct(string);
+    return nullptr;
+}
+
 ACUTILS_HD_FUNC struct AString* AString_constructWithAllocator(ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
 {
     return AString_constructWithCapacityAndAllocator(private_ACUtils_AString_capacityMin, reallocator, deallocator);
@@ -44,31 +245,110 @@ struct AString *AString_constructFromCStringWithAllocator(const char *cstr, size
 }
 ACUTILS_HD_FUNC struct AString* AString_constructWithCapacityAndAllocator(size_t capacity, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
 {
-    struct AString *string;
     if(reallocator == nullptr || deallocator == nullptr)
         return nullptr;
-    if(capacity < private_ACUtils_AString_capacityMin)
-        capacity = private_ACUtils_AString_capacityMin;
-    string = (struct AString*) reallocator(nullptr, sizeof(struct AString));
+    return private_ACUtils_AString_constructGeneric(capacity, reallocator, deallocator, nullptr, 0);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructWithAllocatorObject(const struct ACUtilsAllocator *allocator)
+{
+    return AString_constructWithCapacityAndAllocatorObject(private_ACUtils_AString_capacityMin, allocator);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructFromCStringWithAllocatorObject(const char *cstr, size_t len, const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == nullptr || allocator->reallocator == nullptr || allocator->deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructFromCStringGeneric(cstr, len, nullptr, nullptr, allocator, 0);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructWithCapacityAndAllocatorObject(size_t capacity, const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == nullptr || allocator->reallocator == nullptr || allocator->deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructGeneric(capacity, nullptr, nullptr, allocator, 0);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructCompactFromCString(const char *cstr, size_t len)
+{
+    return private_ACUtils_AString_constructFromCStringGeneric(cstr, len, realloc, free, nullptr, private_ACUtils_AString_flagInlineBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructCompactWithCapacityAndAllocator(size_t capacity, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    if(reallocator == nullptr || deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructGeneric(capacity, reallocator, deallocator, nullptr, private_ACUtils_AString_flagInlineBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructCompactWithCapacityAndAllocatorObject(size_t capacity, const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == nullptr || allocator->reallocator == nullptr || allocator->deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructGeneric(capacity, nullptr, nullptr, allocator, private_ACUtils_AString_flagInlineBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructSmall(void)
+{
+    return AString_constructSmallWithAllocator(realloc, free);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructSmallFromCString(const char *cstr, size_t len)
+{
+    return private_ACUtils_AString_constructFromCStringGeneric(cstr, len, realloc, free, nullptr, private_ACUtils_AString_flagSmallBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructSmallWithAllocator(ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    if(reallocator == nullptr || deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructGeneric(0, reallocator, deallocator, nullptr, private_ACUtils_AString_flagSmallBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructSmallWithAllocatorObject(const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == nullptr || allocator->reallocator == nullptr || allocator->deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructGeneric(0, nullptr, nullptr, allocator, private_ACUtils_AString_flagSmallBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructSmallFromCStringWithAllocatorObject(const char *cstr, size_t len, const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == nullptr || allocator->reallocator == nullptr || allocator->deallocator == nullptr)
+        return nullptr;
+    return private_ACUtils_AString_constructFromCStringGeneric(cstr, len, nullptr, nullptr, allocator, private_ACUtils_AString_flagSmallBuffer);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructInBuffer(void *buffer, size_t bufferSize)
+{
+    return AString_constructInBufferWithAllocator(buffer, bufferSize, realloc, free);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructInBufferWithAllocator(void *buffer, size_t bufferSize, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    size_t charCount;
+    struct AString *string = private_ACUtils_AString_constructInStorage(buffer, bufferSize, 1, &charCount, reallocator, deallocator);
     if(string != nullptr) {
-        struct AString tmpString = { reallocator, deallocator};
-        memcpy(string, &tmpString, sizeof(struct AString));
         string->size = 0;
-        string->capacity = capacity;
-        string->buffer = (char*) string->reallocator(nullptr, (string->capacity + 1) * sizeof(char));
-        if(string->buffer == nullptr) {
-            AString_destruct(string);
-            return nullptr;
-        }
+        string->capacity = charCount / sizeof(char) - 1; /* -1 for '\0' */
+        string->buffer = (char*) (string + 1);
         string->buffer[0] = '\0';
     }
     return string;
 }
+ACUTILS_HD_FUNC struct AString* AString_constructFromLiteral(void *buffer, size_t bufferSize, const char *literal, size_t len)
+{
+    return AString_constructFromLiteralWithAllocator(buffer, bufferSize, literal, len, realloc, free);
+}
+ACUTILS_HD_FUNC struct AString* AString_constructFromLiteralWithAllocator(void *buffer, size_t bufferSize, const char *literal, size_t len, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    size_t charCount;
+    struct AString *string;
+    if(literal == nullptr || literal[len] != '\0')
+        return nullptr;
+    string = private_ACUtils_AString_constructInStorage(buffer, bufferSize, 0, &charCount, reallocator, deallocator);
+    if(string != nullptr) {
+        string->size = len;
+        string->capacity = len;
+        string->buffer = (char*) literal;
+        string->flags |= private_ACUtils_AString_flagReadOnlyBuffer;
+    }
+    return string;
+}
 ACUTILS_HD_FUNC void AString_destruct(struct AString *str)
 {
     if(str != nullptr) {
-        str->deallocator(str->buffer);
-        str->deallocator(str);
+        if(!(str->flags & private_ACUtils_AString_flagInlineBuffer))
+            private_ACUtils_AString_deallocate(str, str->buffer);
+        if(!(str->flags & private_ACUtils_AString_flagBorrowedStruct))
+            private_ACUtils_AString_deallocate(str, str);
     }
 }
 
@@ -80,6 +360,29 @@ ACUTILS_HD_FUNC ACUtilsDeallocator AString_deallocator(const struct AString *str
 {
     return str == nullptr ? nullptr : str->deallocator;
 }
+ACUTILS_HD_FUNC const struct ACUtilsAllocator* AString_allocator(const struct AString *str)
+{
+    return (str == nullptr || str->allocator.reallocator == nullptr) ? nullptr : &str->allocator;
+}
+
+ACUTILS_HD_FUNC ACUtilsGrowStrategy AString_growStrategy(const struct AString *str)
+{
+    return str == nullptr ? nullptr : str->growStrategy;
+}
+ACUTILS_HD_FUNC void AString_setGrowStrategy(struct AString *str, ACUtilsGrowStrategy growStrategy)
+{
+    if(str != nullptr)
+        str->growStrategy = growStrategy;
+}
+ACUTILS_HD_FUNC void AString_setReclaimSlack(struct AString *str, bool reclaimSlack)
+{
+    if(str != nullptr) {
+        if(reclaimSlack)
+            str->flags |= private_ACUtils_AString_flagReclaimSlack;
+        else
+            str->flags &= ~private_ACUtils_AString_flagReclaimSlack;
+    }
+}
 
 ACUTILS_HD_FUNC const char* AString_buffer(const struct AString *str)
 {
@@ -94,28 +397,30 @@ ACUTILS_HD_FUNC size_t AString_size(const struct AString *str)
     return str == nullptr ? 0 : str->size;
 }
 
+/* returns the capacity the grow strategy of str aims at for reserveSize chars, which is less than reserveSize if the grow
+ * strategy can't provide enough chars */
+static size_t private_ACUtils_AString_aimedCapacity(const struct AString *str, size_t reserveSize)
+{
+    if(str->growStrategy != nullptr)
+        return str->growStrategy(reserveSize, sizeof(char));
+    else if(reserveSize >= private_ACUtils_AString_capacityMin)
+        return private_ACUtils_ADynArray_growStrategyGeneric(reserveSize, 2, -1, (double) private_ACUtils_AString_capacityMul,
+                                                             private_ACUtils_AString_capacityAllocMax);
+    return private_ACUtils_AString_capacityMin;
+}
+
 ACUTILS_HD_FUNC bool AString_reserve(struct AString *str, size_t reserveSize)
 {
     if(str != nullptr) {
         if(reserveSize > str->capacity) {
-            size_t aimedCapacity = private_ACUtils_AString_capacityMin;
-            if(reserveSize >= private_ACUtils_AString_capacityMin) {
-                double multiplierExponent =
-                        (ceil(log((double) reserveSize / 2) / log(private_ACUtils_AString_capacityMul)));
-                aimedCapacity = (size_t) (2 * pow((double) private_ACUtils_AString_capacityMul, multiplierExponent));
-                if(aimedCapacity - reserveSize > private_ACUtils_AString_capacityAllocMax)
-                    aimedCapacity = reserveSize + private_ACUtils_AString_capacityAllocMax;
-            }
-            if(aimedCapacity >= reserveSize) {
-                char *tmpBuffer = (char*) str->reallocator(str->buffer, (aimedCapacity + 1) * sizeof(char));
-                if(tmpBuffer != nullptr) {
-                    str->capacity = aimedCapacity;
-                    str->buffer = tmpBuffer;
-                    return true;
-                }
+            size_t aimedCapacity = private_ACUtils_AString_aimedCapacity(str, reserveSize);
+            if(aimedCapacity >= reserveSize && private_ACUtils_AString_reallocateBuffer(str, aimedCapacity)) {
+                /* a read only buffer was moved to an own allocation */
+                str->flags &= ~private_ACUtils_AString_flagReadOnlyBuffer;
+                return true;
             }
         } else {
-            return true;
+            return private_ACUtils_AString_makeWritable(str);
         }
     }
     return false;
@@ -124,13 +429,17 @@ ACUTILS_HD_FUNC bool AString_shrinkToFit(struct AString *str)
 {
     if(str != nullptr) {
         size_t newCapacity = (str->size < private_ACUtils_AString_capacityMin) ? private_ACUtils_AString_capacityMin : str->size;
-        if(newCapacity < str->capacity) {
-            char *tmpBuffer = (char *) str->reallocator(str->buffer, (newCapacity + 1) * sizeof(char));
-            if(tmpBuffer != nullptr) {
-                str->capacity = newCapacity;
-                str->buffer = tmpBuffer;
-                return true;
-            }
+        if((str->flags & private_ACUtils_AString_flagSmallBuffer) && !(str->flags & private_ACUtils_AString_flagInlineBuffer)
+           && str->size <= private_ACUtils_AString_smallCapacity) {
+            char *smallBuffer = (char*) (str + 1);
+            memcpy(smallBuffer, str->buffer, (str->size + 1) * sizeof(char));
+            private_ACUtils_AString_deallocate(str, str->buffer);
+            str->buffer = smallBuffer;
+            str->capacity = private_ACUtils_AString_smallCapacity;
+            str->flags |= private_ACUtils_AString_flagInlineBuffer;
+            return true;
+        } else if(newCapacity < str->capacity && !(str->flags & private_ACUtils_AString_flagInlineBuffer)) {
+            return private_ACUtils_AString_reallocateBuffer(str, newCapacity);
         } else {
             return true;
         }
@@ -140,14 +449,14 @@ ACUTILS_HD_FUNC bool AString_shrinkToFit(struct AString *str)
 
 ACUTILS_HD_FUNC void AString_clear(struct AString *str)
 {
-    if(str != nullptr) {
+    if(str != nullptr && private_ACUtils_AString_makeWritable(str)) {
         str->size = 0;
         str->buffer[0] = '\0';
     }
 }
 ACUTILS_HD_FUNC void AString_remove(struct AString *str, size_t index, size_t count)
 {
-    if(str != nullptr && index < str->size) {
+    if(str != nullptr && index < str->size && private_ACUtils_AString_makeWritable(str)) {
         if(count >= ((size_t) 0) - index - 1 || index + count >= str->size) {
             str->size = index;
             str->buffer[str->size] = '\0';
@@ -165,7 +474,7 @@ ACUTILS_HD_FUNC void AString_trim(struct AString *str, char c)
 ACUTILS_HD_FUNC void AString_trimFront(struct AString *str, char c)
 {
     size_t trimCount = 0;
-    if(str == nullptr)
+    if(str == nullptr || !private_ACUtils_AString_makeWritable(str))
         return;
     while(str->buffer[trimCount] == c && trimCount < str->size)
         ++trimCount;
@@ -177,7 +486,7 @@ ACUTILS_HD_FUNC void AString_trimFront(struct AString *str, char c)
 ACUTILS_HD_FUNC void AString_trimBack(struct AString *str, char c)
 {
     size_t trimmedSize;
-    if(str == nullptr || str->size == 0)
+    if(str == nullptr || str->size == 0 || !private_ACUtils_AString_makeWritable(str))
         return;
     trimmedSize = str->size;
     while(trimmedSize > 0 && str->buffer[trimmedSize - 1] == c)
@@ -194,8 +503,31 @@ ACUTILS_HD_FUNC bool AString_insert(struct AString *str, size_t index, char c)
     }
     return AString_insertCString(str, index, &c, 1);
 }
+/* inserts len chars of cstr at index into a new buffer, which copies every char once instead of reallocating (copying all
+ * chars) and moving the chars behind index again, cstr may point into the old buffer */
+static bool private_ACUtils_AString_insertWithGrowth(struct AString *str, size_t index, const char *cstr, size_t len)
+{
+    char *tmpBuffer;
+    size_t capacity;
+    if(len > ((size_t) -1) - 2 - str->size)
+        return false;
+    capacity = private_ACUtils_AString_aimedCapacity(str, str->size + len);
+    if(capacity < str->size + len || capacity == ((size_t) -1))
+        return false;
+    tmpBuffer = (char*) private_ACUtils_AString_reallocate(str, nullptr, (capacity + 1) * sizeof(char));
+    if(tmpBuffer == nullptr)
+        return false;
+    memcpy(tmpBuffer, str->buffer, index);
+    memcpy(tmpBuffer + index, cstr, len);
+    memcpy(tmpBuffer + index + len, str->buffer + index, str->size - index + 1); /* +1 for '\0' */
+    private_ACUtils_AString_replaceBuffer(str, tmpBuffer, capacity);
+    str->size += len;
+    return true;
+}
 ACUTILS_HD_FUNC bool AString_insertCString(struct AString *str, size_t index, const char *cstr, size_t len)
 {
+    if(str != nullptr && cstr != nullptr && index < str->size && len > str->capacity - str->size)
+        return private_ACUtils_AString_insertWithGrowth(str, index, cstr, len);
     if(str != nullptr && cstr != nullptr && AString_reserve(str, str->size + len)) {
         char *insertPtr;
         if(index > str->size)
@@ -241,6 +573,8 @@ ACUTILS_HD_FUNC bool AString_set(struct AString *str, size_t index, char c)
         return false;
     else if(index >= str->size)
         return AString_append(str, c);
+    else if(!private_ACUtils_AString_makeWritable(str))
+        return false;
     str->buffer[index] = c;
     return true;
 }
@@ -261,6 +595,8 @@ ACUTILS_HD_FUNC bool AString_replaceRange(struct AString *str, size_t index, siz
         index = str->size;
     if(count >= ((size_t) 0) - index - 1 || index + count >= str->size)
         count = str->size - index;
+    if(!private_ACUtils_AString_makeWritable(str))
+        return false;
     if(len < count) {
         AString_remove(str, index, count - len);
     } else if(len > count) {
@@ -270,7 +606,7 @@ ACUTILS_HD_FUNC bool AString_replaceRange(struct AString *str, size_t index, siz
         memmove(str->buffer + index + len, str->buffer + index + count, str->size - index - count + 1);
         str->size = requiredSize;
     }
-    memset(str->buffer + index, c, len);
+    private_ACUtils_ADynArray_fill(str->buffer + index, &c, len, sizeof(char));
     return true;
 }
 ACUTILS_HD_FUNC bool AString_replaceRangeCString(struct AString *str, size_t index, size_t count, const char *cstr, size_t len)
@@ -285,6 +621,8 @@ ACUTILS_HD_FUNC bool AString_replaceRangeCString(struct AString *str, size_t ind
         return AString_appendCString(str, cstr, len);
     if(count >= ((size_t) 0) - index - 1 || index + count >= str->size)
         count = str->size - index;
+    if(!private_ACUtils_AString_makeWritable(str))
+        return false;
     if(len < count) {
         AString_remove(str, index, count - len);
     } else if(len > count) {
@@ -308,7 +646,7 @@ ACUTILS_HD_FUNC bool AString_replaceRangeAString(struct AString *str, size_t ind
 ACUTILS_HD_FUNC void AString_replace(struct AString *str, char old, char rep, size_t count)
 {
     size_t i;
-    if(str == nullptr)
+    if(str == nullptr || !private_ACUtils_AString_makeWritable(str))
         return;
     for(i = 0; i < str->size; ++i) {
         if(str->buffer[i] == old) {
@@ -318,42 +656,151 @@ ACUTILS_HD_FUNC void AString_replace(struct AString *str, char old, char rep, si
         }
     }
 }
+/* needles of at least this length are searched with Boyer-Moore-Horspool if the haystack is long enough to pay off the
+ * setup of the skip table */
+static const size_t private_ACUtils_AString_horspoolMinLength = 16;
+static const size_t private_ACUtils_AString_horspoolMinHaystack = 4 * (UCHAR_MAX + 1);
+
+/* returns the index of the first match of needle (len > 0) in haystack or ACUTILS_ASTRING_NOT_FOUND */
+static size_t private_ACUtils_AString_search(const char *haystack, size_t size, const char *needle, size_t len)
+{
+    size_t i, lastStart;
+    if(len > size)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    lastStart = size - len;
+    if(len < private_ACUtils_AString_horspoolMinLength || lastStart < private_ACUtils_AString_horspoolMinHaystack) {
+        /* memchr skips to the candidates, the last char is compared first as it often rejects them cheaper */
+        const char *candidate;
+        for(i = 0; i <= lastStart; i = (size_t) (candidate - haystack) + 1) {
+            candidate = (const char*) memchr(haystack + i, needle[0], lastStart - i + 1);
+            if(candidate == nullptr)
+                break;
+            if(candidate[len - 1] == needle[len - 1] && memcmp(candidate + 1, needle + 1, len - 1) == 0)
+                return (size_t) (candidate - haystack);
+        }
+    } else {
+        size_t skip[UCHAR_MAX + 1];
+        unsigned char last = (unsigned char) needle[len - 1];
+        for(i = 0; i <= UCHAR_MAX; ++i)
+            skip[i] = len;
+        for(i = 0; i < len - 1; ++i)
+            skip[(unsigned char) needle[i]] = len - 1 - i;
+        for(i = 0; i <= lastStart; i += skip[(unsigned char) haystack[i + len - 1]]) {
+            if((unsigned char) haystack[i + len - 1] == last && memcmp(haystack + i, needle, len - 1) == 0)
+                return i;
+        }
+    }
+    return ACUTILS_ASTRING_NOT_FOUND;
+}
+/* returns the index of the last match of needle (len > 0) which starts at or before lastStart in haystack (at least
+ * lastStart + len chars) or ACUTILS_ASTRING_NOT_FOUND, mirrors private_ACUtils_AString_search */
+static size_t private_ACUtils_AString_reverseSearch(const char *haystack, size_t lastStart, const char *needle, size_t len)
+{
+    size_t i;
+    if(len < private_ACUtils_AString_horspoolMinLength || lastStart < private_ACUtils_AString_horspoolMinHaystack) {
+        /* there is no memrchr in C90, so the candidates are filtered with a plain loop for the first char, the last char
+         * is compared first as it often rejects them cheaper */
+        for(i = lastStart + 1; i-- > 0;) {
+            if(haystack[i] == needle[0] && haystack[i + len - 1] == needle[len - 1]
+               && memcmp(haystack + i + 1, needle + 1, len - 1) == 0)
+                return i;
+        }
+    } else {
+        /* Horspool from the back: the window moves to the left, so the skip is decided by the first char of the window
+         * and is the distance to the next occurrence of this char in the needle behind its first char */
+        size_t skip[UCHAR_MAX + 1];
+        unsigned char first = (unsigned char) needle[0];
+        for(i = 0; i <= UCHAR_MAX; ++i)
+            skip[i] = len;
+        for(i = len - 1; i > 0; --i)
+            skip[(unsigned char) needle[i]] = i;
+        for(i = lastStart;; i -= skip[(unsigned char) haystack[i]]) {
+            if((unsigned char) haystack[i] == first && memcmp(haystack + i + 1, needle + 1, len - 1) == 0)
+                return i;
+            if(skip[(unsigned char) haystack[i]] > i)
+                break;
+        }
+    }
+    return ACUTILS_ASTRING_NOT_FOUND;
+}
+/* returns the number of non overlapping matches of old in src (size chars), at most count (0 for all) */
+static size_t private_ACUtils_AString_countMatches(const char *src, size_t size, const char *old, size_t oldLen, size_t count)
+{
+    size_t readIndex = 0, matches = 0, found;
+    while((count == 0 || matches < count)
+          && (found = private_ACUtils_AString_search(src + readIndex, size - readIndex, old, oldLen)) != ACUTILS_ASTRING_NOT_FOUND) {
+        readIndex += found + oldLen;
+        ++matches;
+    }
+    return matches;
+}
+/* writes src (size chars) with its first count (0 for all) non overlapping matches of old replaced by rep to dest and
+ * returns the number of written chars. dest may overlap src if the written chars never reach the unread ones, which
+ * holds if dest starts at src and newLen <= oldLen or src starts behind dest by the growth of the result. */
+static size_t private_ACUtils_AString_replaceMatches(char *dest, const char *src, size_t size, const char *old,
+                                                     size_t oldLen, const char *rep, size_t newLen, size_t count)
+{
+    size_t readIndex = 0, writeIndex = 0, found;
+    while((found = private_ACUtils_AString_search(src + readIndex, size - readIndex, old, oldLen)) != ACUTILS_ASTRING_NOT_FOUND) {
+        if(dest + writeIndex != src + readIndex)
+            memmove(dest + writeIndex, src + readIndex, found);
+        memcpy(dest + writeIndex + found, rep, newLen);
+        writeIndex += found + newLen;
+        readIndex += found + oldLen;
+        if(count > 0 && --count == 0)
+            break;
+    }
+    if(dest + writeIndex != src + readIndex)
+        memmove(dest + writeIndex, src + readIndex, size - readIndex);
+    return writeIndex + size - readIndex;
+}
 ACUTILS_HD_FUNC bool AString_replaceCString(struct AString *str, const char *old, size_t oldLen, const char *rep, size_t newLen, size_t count)
 {
-    size_t i, currentOldIndex = 0, tmpSize, tmpCapacity;
-    char *tmp;
+    size_t matches, replacedSize;
     if(str == nullptr || old == nullptr || oldLen == 0) {
         return false;
     } else if(rep == nullptr) {
         rep = "";
         newLen = 0;
     }
-    tmpSize = str->size;
-    tmpCapacity = str->capacity;
-    tmp = (char*) malloc(tmpCapacity + 1);
-    memcpy(tmp, str->buffer, tmpSize + 1);
-    for(i = 0; i < str->size; ++i) {
-        char c = str->buffer[i];
-        if(c == old[currentOldIndex]) {
-            if(++currentOldIndex == oldLen) {
-                i -= currentOldIndex - 1;
-                if(!AString_replaceRangeCString(str, i, currentOldIndex, rep, newLen)) {
-                    str->capacity = tmpCapacity;
-                    str->size = tmpSize;
-                    memcpy(str->buffer, tmp, tmpSize + 1);
-                    free(tmp);
-                    return false;
-                }
-                if(count > 0 && --count == 0)
-                    goto RETURN;
-                currentOldIndex = 0;
-            }
+    if(newLen <= oldLen) {
+        /* the result is built in place behind the first match, which doesn't move */
+        size_t first = private_ACUtils_AString_search(str->buffer, str->size, old, oldLen);
+        if(first == ACUTILS_ASTRING_NOT_FOUND)
+            return true;
+        if(!private_ACUtils_AString_makeWritable(str))
+            return false;
+        replacedSize = first + private_ACUtils_AString_replaceMatches(str->buffer + first, str->buffer + first,
+                                                                      str->size - first, old, oldLen, rep, newLen, count);
+    } else {
+        matches = private_ACUtils_AString_countMatches(str->buffer, str->size, old, oldLen, count);
+        if(matches == 0)
+            return true;
+        if(matches > (((size_t) -1) - str->size) / (newLen - oldLen))
+            return false;
+        replacedSize = str->size + matches * (newLen - oldLen);
+        if(replacedSize > str->capacity) {
+            /* build the result in the new buffer instead of reallocating and moving the chars again */
+            char *tmpBuffer;
+            size_t capacity = private_ACUtils_AString_aimedCapacity(str, replacedSize);
+            if(capacity < replacedSize || capacity == ((size_t) -1))
+                return false;
+            tmpBuffer = (char*) private_ACUtils_AString_reallocate(str, nullptr, (capacity + 1) * sizeof(char));
+            if(tmpBuffer == nullptr)
+                return false;
+            private_ACUtils_AString_replaceMatches(tmpBuffer, str->buffer, str->size, old, oldLen, rep, newLen, matches);
+            private_ACUtils_AString_replaceBuffer(str, tmpBuffer, capacity);
         } else {
-            currentOldIndex = 0;
+            size_t growth = replacedSize - str->size;
+            if(!private_ACUtils_AString_makeWritable(str))
+                return false;
+            /* moving the chars behind the growth of the result allows to build it front to back in place */
+            memmove(str->buffer + growth, str->buffer, str->size);
+            private_ACUtils_AString_replaceMatches(str->buffer, str->buffer + growth, str->size, old, oldLen, rep, newLen, matches);
         }
     }
-    RETURN:
-    free(tmp);
+    str->size = replacedSize;
+    str->buffer[str->size] = '\0';
     return true;
 }
 ACUTILS_HD_FUNC bool AString_replaceAString(struct AString *str, const struct AString *old, const struct AString *rep, size_t count)
@@ -366,6 +813,35 @@ ACUTILS_HD_FUNC bool AString_replaceAString(struct AString *str, const struct AS
         return AString_replaceCString(str, old->buffer, old->size, rep->buffer, rep->size, count);
 }
 
+ACUTILS_HD_FUNC bool AString_applyEdits(struct AString *str, const struct ACUtilsEdit *edits, size_t editCount)
+{
+    size_t editedSize;
+    if(str == nullptr || (edits == nullptr && editCount > 0)
+       || !private_ACUtils_ADynArray_editedSize(str->size, edits, editCount, &editedSize))
+        return false;
+    if(editedSize > str->capacity) {
+        /* build the result in the new buffer instead of reallocating and moving the chars again */
+        char *tmpBuffer;
+        size_t capacity = private_ACUtils_AString_aimedCapacity(str, editedSize);
+        if(capacity < editedSize || capacity == ((size_t) -1))
+            return false;
+        tmpBuffer = (char*) private_ACUtils_AString_reallocate(str, nullptr, (capacity + 1) * sizeof(char));
+        if(tmpBuffer == nullptr)
+            return false;
+        private_ACUtils_ADynArray_applyEditsToBuffer(tmpBuffer, str->buffer, str->size, edits, editCount, sizeof(char));
+        private_ACUtils_AString_replaceBuffer(str, tmpBuffer, capacity);
+    } else if(editCount > 0) {
+        if(!private_ACUtils_AString_makeWritable(str))
+            return false;
+        private_ACUtils_ADynArray_applyEditsToBuffer(str->buffer, str->buffer, str->size, edits, editCount, sizeof(char));
+    } else {
+        return true;
+    }
+    str->size = editedSize;
+    str->buffer[str->size] = '\0';
+    return true;
+}
+
 ACUTILS_HD_FUNC bool AString_equals(const struct AString *str1, const struct AString *str2)
 {
     if(str2 == nullptr || str1 == nullptr)
@@ -399,12 +875,74 @@ ACUTILS_HD_FUNC int AString_compareCString(const struct AString *str, const char
     return strcmp(str->buffer, cstr);
 }
 
+ACUTILS_HD_FUNC size_t AString_find(const struct AString *str, size_t index, const struct AString *needle)
+{
+    if(needle == nullptr)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    return AString_findCString(str, index, needle->buffer, needle->size);
+}
+ACUTILS_HD_FUNC size_t AString_findCString(const struct AString *str, size_t index, const char *cstr, size_t len)
+{
+    size_t found;
+    if(str == nullptr || cstr == nullptr || index > str->size)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    if(len == 0)
+        return index;
+    found = private_ACUtils_AString_search(str->buffer + index, str->size - index, cstr, len);
+    return (found == ACUTILS_ASTRING_NOT_FOUND) ? found : index + found;
+}
+ACUTILS_HD_FUNC size_t AString_rfind(const struct AString *str, size_t index, const struct AString *needle)
+{
+    if(needle == nullptr)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    return AString_rfindCString(str, index, needle->buffer, needle->size);
+}
+ACUTILS_HD_FUNC size_t AString_rfindCString(const struct AString *str, size_t index, const char *cstr, size_t len)
+{
+    size_t lastStart;
+    if(str == nullptr || cstr == nullptr || len > str->size)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    lastStart = (index < str->size - len) ? index : str->size - len;
+    if(len == 0)
+        return lastStart;
+    return private_ACUtils_AString_reverseSearch(str->buffer, lastStart, cstr, len);
+}
+ACUTILS_HD_FUNC struct AStringOffsets* AString_findAll(const struct AString *str, const struct AString *needle)
+{
+    if(needle == nullptr)
+        return nullptr;
+    return AString_findAllCString(str, needle->buffer, needle->size);
+}
+ACUTILS_HD_FUNC struct AStringOffsets* AString_findAllCString(const struct AString *str, const char *cstr, size_t len)
+{
+    size_t index = 0, found;
+    struct AStringOffsets *offsets;
+    if(str == nullptr || cstr == nullptr || len == 0)
+        return nullptr;
+    if(str->allocator.reallocator != nullptr)
+        offsets = ADynArray_constructWithAllocatorObject(struct AStringOffsets, &str->allocator);
+    else
+        offsets = ADynArray_constructWithAllocator(struct AStringOffsets, str->reallocator, str->deallocator);
+    if(offsets == nullptr)
+        return nullptr;
+    while((found = private_ACUtils_AString_search(str->buffer + index, str->size - index, cstr, len)) != ACUTILS_ASTRING_NOT_FOUND) {
+        index += found;
+        if(!ADynArray_append(offsets, index)) {
+            ADynArray_destruct(offsets);
+            return nullptr;
+        }
+        index += len;
+    }
+    return offsets;
+}
+
 ACUTILS_HD_FUNC struct AString* AString_clone(const struct AString *str)
 {
     struct AString *cloned;
     if(str == nullptr)
         return nullptr;
-    cloned = AString_constructWithCapacityAndAllocator(str->capacity, str->reallocator, str->deallocator);
+    cloned = private_ACUtils_AString_constructWithAllocatorOf(
+            (str->flags & private_ACUtils_AString_flagSmallBuffer) ? str->size : str->capacity, str);
     if(cloned == nullptr)
         return nullptr;
     memcpy(cloned->buffer, str->buffer, str->size + 1);
@@ -420,7 +958,7 @@ ACUTILS_HD_FUNC struct AString* AString_substring(const struct AString *str, siz
         index = str->size;
     if(count >= ((size_t) 0) - index - 1 || index + count >= str->size)
         count = str->size - index;
-    substring = AString_constructWithCapacityAndAllocator(count, str->reallocator, str->deallocator);
+    substring = private_ACUtils_AString_constructWithAllocatorOf(count, str);
     if(substring == nullptr)
         return nullptr;
     memcpy(substring->buffer, str->buffer + index, count);
@@ -435,7 +973,10 @@ ACUTILS_HD_FUNC struct ASplittedString* AString_split(const struct AString *str,
     struct ASplittedString *splitted;
     if(str == nullptr)
         return nullptr;
-    splitted = ADynArray_constructWithAllocator(struct ASplittedString, str->reallocator, str->deallocator);
+    if(str->allocator.reallocator != nullptr)
+        splitted = ADynArray_constructWithAllocatorObject(struct ASplittedString, &str->allocator);
+    else
+        splitted = ADynArray_constructWithAllocator(struct ASplittedString, str->reallocator, str->deallocator);
     if(splitted == nullptr)
         return nullptr;
     for(i = 0; i <= str->size; ++i) {
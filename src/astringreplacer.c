@@ -0,0 +1,306 @@
+#ifndef ACUTILS_ONE_SOURCE
+#   include "../include/ACUtils/astringreplacer.h"
+#endif
+
+#ifdef ACUTILS_ASTRINGREPLACER_H /* if compiled as one source and not included from header, the definitions are excluded */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../include/ACUtils/internal.h"
+
+struct private_ACUtils_AStringReplacer_Pattern
+{
+    size_t length;
+    const char *replacement;
+    size_t replacementLength;
+};
+A_DYNAMIC_ARRAY_DEFINITION(private_ACUtils_AStringReplacer_Edits, struct ACUtilsEdit);
+
+/* everything lives in the allocation of the struct: the patterns, the tables of the automaton and the replacements */
+struct AStringReplacer
+{
+    const ACUtilsReallocator reallocator;
+    const ACUtilsDeallocator deallocator;
+    /* used instead of reallocator and deallocator if its reallocator is set */
+    struct ACUtilsAllocator allocator;
+    size_t patternCount;
+    struct private_ACUtils_AStringReplacer_Pattern *patterns;
+    /* bytes which occur in no pattern are in class 0, every other byte has its own class */
+    unsigned short byteClasses[UCHAR_MAX + 1];
+    size_t classCount;
+    /* the next state for every state and byte class, the root is state 0 */
+    size_t *transitions;
+    /* the length of the pattern prefix a state stands for */
+    size_t *depths;
+    /* the longest pattern which is a suffix of the prefix of a state or noMatch */
+    size_t *matches;
+};
+
+static const size_t private_ACUtils_AStringReplacer_noMatch = (size_t) -1;
+
+/* adds value to sum and returns false if the result doesn't fit into size_t */
+static bool private_ACUtils_AStringReplacer_addSize(size_t *sum, size_t value)
+{
+    if(value > ((size_t) -1) - *sum)
+        return false;
+    *sum += value;
+    return true;
+}
+/* inserts all patterns into the trie of replacer (maxStateCount states are zeroed) and copies the replacements to pool */
+static void private_ACUtils_AStringReplacer_buildTrie(struct AStringReplacer *replacer, const struct AStringReplacement *table,
+                                                     char *pool)
+{
+    size_t i, j, stateCount = 1;
+    replacer->matches[0] = private_ACUtils_AStringReplacer_noMatch;
+    for(i = 0; i < replacer->patternCount; ++i) {
+        size_t state = 0;
+        for(j = 0; j < table[i].patternLen; ++j) {
+            size_t *next = replacer->transitions + (state * replacer->classCount
+                                                    + replacer->byteClasses[(unsigned char) table[i].pattern[j]]);
+            if(*next == 0) {
+                *next = stateCount++;
+                replacer->depths[*next] = replacer->depths[state] + 1;
+                replacer->matches[*next] = private_ACUtils_AStringReplacer_noMatch;
+            }
+            state = *next;
+        }
+        if(replacer->matches[state] == private_ACUtils_AStringReplacer_noMatch)
+            replacer->matches[state] = i;
+        replacer->patterns[i].length = table[i].patternLen;
+        replacer->patterns[i].replacement = pool;
+        replacer->patterns[i].replacementLength = table[i].replacementLen;
+        if(table[i].replacementLen > 0)
+            memcpy(pool, table[i].replacement, table[i].replacementLen);
+        pool += table[i].replacementLen;
+    }
+}
+/* turns the trie into the automaton: in breadth first order every missing transition is taken from the failure state
+ * (the state of the longest proper suffix which is also a pattern prefix) and every state inherits its match from the
+ * failure state if it doesn't end a pattern itself. queue and failures need room for all states. */
+static void private_ACUtils_AStringReplacer_buildAutomaton(struct AStringReplacer *replacer, size_t *queue, size_t *failures)
+{
+    size_t c, queueStart, queueEnd = 0;
+    for(c = 0; c < replacer->classCount; ++c) {
+        size_t child = replacer->transitions[c];
+        if(child != 0) {
+            failures[child] = 0;
+            queue[queueEnd++] = child;
+        }
+    }
+    for(queueStart = 0; queueStart < queueEnd; ++queueStart) {
+        size_t state = queue[queueStart];
+        size_t *next = replacer->transitions + state * replacer->classCount;
+        const size_t *fallback = replacer->transitions + failures[state] * replacer->classCount;
+        if(replacer->matches[state] == private_ACUtils_AStringReplacer_noMatch)
+            replacer->matches[state] = replacer->matches[failures[state]];
+        for(c = 0; c < replacer->classCount; ++c) {
+            if(next[c] != 0) {
+                failures[next[c]] = fallback[c];
+                queue[queueEnd++] = next[c];
+            } else {
+                next[c] = fallback[c];
+            }
+        }
+    }
+}
+/* allocates through allocator if it is set, otherwise through reallocator */
+static void* private_ACUtils_AStringReplacer_allocate(ACUtilsReallocator reallocator, const struct ACUtilsAllocator *allocator,
+                                                      size_t size)
+{
+    if(allocator != NULL)
+        return allocator->reallocator(allocator->context, NULL, size);
+    return reallocator(NULL, size);
+}
+static void private_ACUtils_AStringReplacer_deallocate(ACUtilsDeallocator deallocator, const struct ACUtilsAllocator *allocator,
+                                                       void *ptr)
+{
+    if(allocator != NULL)
+        allocator->deallocator(allocator->context, ptr);
+    else
+        deallocator(ptr);
+}
+/* stores the leftmost-longest match in text (size chars) which starts at or behind index in match. The scan reads at
+ * most the length of the longest pattern behind the end of the match, which the search for the next match reads
+ * again, so finding all matches takes O(size + matchCount * longest pattern length) steps. */
+static bool private_ACUtils_AStringReplacer_next(const struct AStringReplacer *replacer, const char *text, size_t size,
+                                                 size_t index, struct AStringMatch *match)
+{
+    size_t i, state = 0, candidateStart = (size_t) -1, candidatePattern = 0;
+    for(i = index; i < size; ++i) {
+        state = replacer->transitions[state * replacer->classCount + replacer->byteClasses[(unsigned char) text[i]]];
+        if(replacer->matches[state] != private_ACUtils_AStringReplacer_noMatch) {
+            size_t start = i + 1 - replacer->patterns[replacer->matches[state]].length;
+            if(start <= candidateStart) {
+                candidateStart = start;
+                candidatePattern = replacer->matches[state];
+            }
+        }
+        /* a later match starts at or behind i + 1 - depth, so none can start before the candidate any more */
+        if(candidateStart != (size_t) -1 && i + 1 - replacer->depths[state] > candidateStart)
+            break;
+    }
+    if(candidateStart == (size_t) -1)
+        return false;
+    match->index = candidateStart;
+    match->pattern = candidatePattern;
+    return true;
+}
+
+/* allocator is null or used instead of reallocator and deallocator */
+static struct AStringReplacer* private_ACUtils_AStringReplacer_constructGeneric(const struct AStringReplacement *table,
+                                                                                size_t count,
+                                                                                ACUtilsReallocator reallocator,
+                                                                                ACUtilsDeallocator deallocator,
+                                                                                const struct ACUtilsAllocator *allocator)
+{
+    size_t i, j, maxStateCount = 1, replacementSize = 0, classCount = 1, allocationSize, tablesOffset, poolOffset;
+    unsigned short byteClasses[UCHAR_MAX + 1];
+    struct AStringReplacer *replacer;
+    size_t *buildBuffer;
+    if(table == NULL && count > 0)
+        return NULL;
+    memset(byteClasses, 0, sizeof(byteClasses));
+    for(i = 0; i < count; ++i) {
+        if(table[i].pattern == NULL || table[i].patternLen == 0 || (table[i].replacement == NULL && table[i].replacementLen > 0)
+           || !private_ACUtils_AStringReplacer_addSize(&maxStateCount, table[i].patternLen)
+           || !private_ACUtils_AStringReplacer_addSize(&replacementSize, table[i].replacementLen))
+            return NULL;
+        for(j = 0; j < table[i].patternLen; ++j) {
+            if(byteClasses[(unsigned char) table[i].pattern[j]] == 0)
+                byteClasses[(unsigned char) table[i].pattern[j]] = (unsigned short) classCount++;
+        }
+    }
+    /* the transitions, depths and matches of every state and during the build a queue and the failure states */
+    if(count > ((size_t) -1) / sizeof(struct private_ACUtils_AStringReplacer_Pattern)
+       || maxStateCount > ((size_t) -1) / sizeof(size_t) / (classCount + 2))
+        return NULL;
+    tablesOffset = private_ACUtils_alignUp(sizeof(struct AStringReplacer))
+                   + private_ACUtils_alignUp(count * sizeof(struct private_ACUtils_AStringReplacer_Pattern));
+    poolOffset = tablesOffset;
+    allocationSize = tablesOffset;
+    if(!private_ACUtils_AStringReplacer_addSize(&poolOffset, maxStateCount * (classCount + 2) * sizeof(size_t))
+       || !private_ACUtils_AStringReplacer_addSize(&allocationSize, poolOffset - tablesOffset)
+       || !private_ACUtils_AStringReplacer_addSize(&allocationSize, replacementSize))
+        return NULL;
+    replacer = (struct AStringReplacer*) private_ACUtils_AStringReplacer_allocate(reallocator, allocator, allocationSize);
+    if(replacer == NULL)
+        return NULL;
+    buildBuffer = (size_t*) private_ACUtils_AStringReplacer_allocate(reallocator, allocator,
+                                                                     2 * maxStateCount * sizeof(size_t));
+    if(buildBuffer == NULL) {
+        private_ACUtils_AStringReplacer_deallocate(deallocator, allocator, replacer);
+        return NULL;
+    } else {
+        struct AStringReplacer tmpReplacer = {reallocator, deallocator};
+        memcpy(replacer, &tmpReplacer, sizeof(struct AStringReplacer));
+    }
+    if(allocator != NULL)
+        replacer->allocator = *allocator;
+    replacer->patternCount = count;
+    replacer->patterns = (struct private_ACUtils_AStringReplacer_Pattern*)
+            (((char*) replacer) + private_ACUtils_alignUp(sizeof(struct AStringReplacer)));
+    memcpy(replacer->byteClasses, byteClasses, sizeof(byteClasses));
+    replacer->classCount = classCount;
+    replacer->transitions = (size_t*) (((char*) replacer) + tablesOffset);
+    replacer->depths = replacer->transitions + maxStateCount * classCount;
+    replacer->matches = replacer->depths + maxStateCount;
+    memset(replacer->transitions, 0, maxStateCount * (classCount + 1) * sizeof(size_t));
+    private_ACUtils_AStringReplacer_buildTrie(replacer, table, ((char*) replacer) + poolOffset);
+    private_ACUtils_AStringReplacer_buildAutomaton(replacer, buildBuffer, buildBuffer + maxStateCount);
+    private_ACUtils_AStringReplacer_deallocate(deallocator, allocator, buildBuffer);
+    return replacer;
+}
+
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_construct(const struct AStringReplacement *table, size_t count)
+{
+    return AStringReplacer_constructWithAllocator(table, count, realloc, free);
+}
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_constructWithAllocator(const struct AStringReplacement *table, size_t count, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    if(reallocator == NULL || deallocator == NULL)
+        return NULL;
+    return private_ACUtils_AStringReplacer_constructGeneric(table, count, reallocator, deallocator, NULL);
+}
+ACUTILS_HD_FUNC struct AStringReplacer* AStringReplacer_constructWithAllocatorObject(const struct AStringReplacement *table, size_t count, const struct ACUtilsAllocator *allocator)
+{
+    if(allocator == NULL || allocator->reallocator == NULL || allocator->deallocator == NULL)
+        return NULL;
+    return private_ACUtils_AStringReplacer_constructGeneric(table, count, NULL, NULL, allocator);
+}
+ACUTILS_HD_FUNC void AStringReplacer_destruct(struct AStringReplacer *replacer)
+{
+    if(replacer != NULL) {
+        const struct ACUtilsAllocator *allocator = (replacer->allocator.reallocator != NULL) ? &replacer->allocator : NULL;
+        private_ACUtils_AStringReplacer_deallocate(replacer->deallocator, allocator, replacer);
+    }
+}
+
+ACUTILS_HD_FUNC size_t AStringReplacer_patternCount(const struct AStringReplacer *replacer)
+{
+    return (replacer == NULL) ? 0 : replacer->patternCount;
+}
+
+ACUTILS_HD_FUNC bool AStringReplacer_find(const struct AStringReplacer *replacer, const struct AString *str, size_t index, struct AStringMatch *match)
+{
+    if(replacer == NULL || str == NULL || match == NULL)
+        return false;
+    return private_ACUtils_AStringReplacer_next(replacer, AString_buffer(str), AString_size(str), index, match);
+}
+ACUTILS_HD_FUNC struct AStringMatches* AStringReplacer_findAny(const struct AStringReplacer *replacer, const struct AString *str)
+{
+    struct AStringMatch match;
+    struct AStringMatches *matches;
+    size_t index = 0;
+    if(replacer == NULL || str == NULL)
+        return NULL;
+    if(replacer->allocator.reallocator != NULL)
+        matches = ADynArray_constructWithAllocatorObject(struct AStringMatches, &replacer->allocator);
+    else
+        matches = ADynArray_constructWithAllocator(struct AStringMatches, replacer->reallocator, replacer->deallocator);
+    if(matches == NULL)
+        return NULL;
+    while(private_ACUtils_AStringReplacer_next(replacer, AString_buffer(str), AString_size(str), index, &match)) {
+        if(!ADynArray_append(matches, match)) {
+            ADynArray_destruct(matches);
+            return NULL;
+        }
+        index = match.index + replacer->patterns[match.pattern].length;
+    }
+    return matches;
+}
+ACUTILS_HD_FUNC bool AStringReplacer_apply(const struct AStringReplacer *replacer, struct AString *str)
+{
+    struct AStringMatch match;
+    struct private_ACUtils_AStringReplacer_Edits *edits;
+    size_t index = 0;
+    bool applied;
+    if(replacer == NULL || str == NULL)
+        return false;
+    if(replacer->allocator.reallocator != NULL)
+        edits = ADynArray_constructWithAllocatorObject(struct private_ACUtils_AStringReplacer_Edits, &replacer->allocator);
+    else
+        edits = ADynArray_constructWithAllocator(struct private_ACUtils_AStringReplacer_Edits, replacer->reallocator,
+                                                 replacer->deallocator);
+    if(edits == NULL)
+        return false;
+    while(private_ACUtils_AStringReplacer_next(replacer, AString_buffer(str), AString_size(str), index, &match)) {
+        struct ACUtilsEdit edit;
+        const struct private_ACUtils_AStringReplacer_Pattern *pattern = replacer->patterns + match.pattern;
+        edit.index = match.index;
+        edit.removeCount = pattern->length;
+        edit.insertData = pattern->replacement;
+        edit.insertCount = pattern->replacementLength;
+        if(!ADynArray_append(edits, edit)) {
+            ADynArray_destruct(edits);
+            return false;
+        }
+        index = match.index + pattern->length;
+    }
+    applied = AString_applyEdits(str, edits->buffer, edits->size);
+    ADynArray_destruct(edits);
+    return applied;
+}
+
+#endif /* ACUTILS_ASTRINGREPLACER_H */
@@ -0,0 +1,190 @@
+#ifndef ACUTILS_ONE_SOURCE
+#   include "../include/ACUtils/astringtemplate.h"
+#endif
+
+#ifdef ACUTILS_ASTRINGTEMPLATE_H /* if compiled as one source and not included from header, the definitions are excluded */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/ACUtils/internal.h"
+
+/* a literal followed by a slot, the last part of a template has no slot */
+struct private_ACUtils_AStringTemplate_Part
+{
+    size_t literalOffset;
+    size_t literalLength;
+    size_t slot;
+};
+struct private_ACUtils_AStringTemplate_Slot
+{
+    size_t nameOffset;
+    size_t nameLength;
+};
+
+/* everything lives in the allocation of the struct: the parts, the slots and the chars of the literals and names */
+struct AStringTemplate
+{
+    const ACUtilsReallocator reallocator;
+    const ACUtilsDeallocator deallocator;
+    size_t partCount;
+    struct private_ACUtils_AStringTemplate_Part *parts;
+    size_t slotCount;
+    struct private_ACUtils_AStringTemplate_Slot *slots;
+    char *chars;
+    /* the sum of the lengths of all literals */
+    size_t literalSize;
+};
+
+static const size_t private_ACUtils_AStringTemplate_noSlot = (size_t) -1;
+
+/* splits cstr into the parts and slots of stringTemplate, which has room for the parts and slots of len / 3
+ * placeholders (each takes at least three chars) and len chars, returns false if cstr is no valid template */
+static bool private_ACUtils_AStringTemplate_parse(struct AStringTemplate *stringTemplate, const char *cstr, size_t len)
+{
+    size_t i = 0, charCount = 0;
+    struct private_ACUtils_AStringTemplate_Part *part = stringTemplate->parts;
+    part->literalOffset = 0;
+    while(i < len) {
+        if((cstr[i] == '{' || cstr[i] == '}') && i + 1 < len && cstr[i + 1] == cstr[i]) {
+            stringTemplate->chars[charCount++] = cstr[i];
+            i += 2;
+        } else if(cstr[i] == '{') {
+            const char *name = cstr + i + 1;
+            const char *nameEnd = (const char*) memchr(name, '}', len - i - 1);
+            size_t nameLength;
+            if(nameEnd == NULL || nameEnd == name || memchr(name, '{', (size_t) (nameEnd - name)) != NULL)
+                return false;
+            nameLength = (size_t) (nameEnd - name);
+            part->literalLength = charCount - part->literalOffset;
+            stringTemplate->literalSize += part->literalLength;
+            part->slot = AStringTemplate_slotIndex(stringTemplate, name, nameLength);
+            if(part->slot == ACUTILS_ASTRING_NOT_FOUND) {
+                part->slot = stringTemplate->slotCount++;
+                stringTemplate->slots[part->slot].nameOffset = charCount;
+                stringTemplate->slots[part->slot].nameLength = nameLength;
+                memcpy(stringTemplate->chars + charCount, name, nameLength);
+                charCount += nameLength;
+            }
+            ++part;
+            ++stringTemplate->partCount;
+            part->literalOffset = charCount;
+            i += nameLength + 2;
+        } else if(cstr[i] == '}') {
+            return false;
+        } else {
+            stringTemplate->chars[charCount++] = cstr[i++];
+        }
+    }
+    part->literalLength = charCount - part->literalOffset;
+    part->slot = private_ACUtils_AStringTemplate_noSlot;
+    stringTemplate->literalSize += part->literalLength;
+    return true;
+}
+
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_construct(const struct AString *templateStr)
+{
+    if(templateStr == NULL)
+        return NULL;
+    return AStringTemplate_constructFromCString(AString_buffer(templateStr), AString_size(templateStr));
+}
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_constructFromCString(const char *cstr, size_t len)
+{
+    return AStringTemplate_constructFromCStringWithAllocator(cstr, len, realloc, free);
+}
+ACUTILS_HD_FUNC struct AStringTemplate* AStringTemplate_constructFromCStringWithAllocator(const char *cstr, size_t len, ACUtilsReallocator reallocator, ACUtilsDeallocator deallocator)
+{
+    size_t partsOffset, slotsOffset, charsOffset, maxPlaceholders = len / 3;
+    struct AStringTemplate *stringTemplate;
+    if(cstr == NULL || reallocator == NULL || deallocator == NULL || len >= ((size_t) -1) / 2
+       || maxPlaceholders >= ((size_t) -1) / 4 / (sizeof(struct private_ACUtils_AStringTemplate_Part)
+                                                + sizeof(struct private_ACUtils_AStringTemplate_Slot)))
+        return NULL;
+    partsOffset = private_ACUtils_alignUp(sizeof(struct AStringTemplate));
+    slotsOffset = partsOffset + private_ACUtils_alignUp(
+            (maxPlaceholders + 1) * sizeof(struct private_ACUtils_AStringTemplate_Part));
+    charsOffset = slotsOffset + private_ACUtils_alignUp(
+            maxPlaceholders * sizeof(struct private_ACUtils_AStringTemplate_Slot));
+    stringTemplate = (struct AStringTemplate*) reallocator(NULL, charsOffset + len);
+    if(stringTemplate != NULL) {
+        struct AStringTemplate tmpTemplate = {reallocator, deallocator};
+        memcpy(stringTemplate, &tmpTemplate, sizeof(struct AStringTemplate));
+        stringTemplate->partCount = 1;
+        stringTemplate->parts = (struct private_ACUtils_AStringTemplate_Part*) (((char*) stringTemplate) + partsOffset);
+        stringTemplate->slotCount = 0;
+        stringTemplate->slots = (struct private_ACUtils_AStringTemplate_Slot*) (((char*) stringTemplate) + slotsOffset);
+        stringTemplate->chars = ((char*) stringTemplate) + charsOffset;
+        stringTemplate->literalSize = 0;
+        if(!private_ACUtils_AStringTemplate_parse(stringTemplate, cstr, len)) {
+            deallocator(stringTemplate);
+            return NULL;
+        }
+    }
+    return stringTemplate;
+}
+ACUTILS_HD_FUNC void AStringTemplate_destruct(struct AStringTemplate *stringTemplate)
+{
+    if(stringTemplate != NULL)
+        stringTemplate->deallocator(stringTemplate);
+}
+
+ACUTILS_HD_FUNC size_t AStringTemplate_slotCount(const struct AStringTemplate *stringTemplate)
+{
+    return (stringTemplate == NULL) ? 0 : stringTemplate->slotCount;
+}
+ACUTILS_HD_FUNC size_t AStringTemplate_slotIndex(const struct AStringTemplate *stringTemplate, const char *name, size_t len)
+{
+    size_t i;
+    if(stringTemplate == NULL || name == NULL)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    for(i = 0; i < stringTemplate->slotCount; ++i) {
+        if(stringTemplate->slots[i].nameLength == len
+           && memcmp(stringTemplate->chars + stringTemplate->slots[i].nameOffset, name, len) == 0)
+            return i;
+    }
+    return ACUTILS_ASTRING_NOT_FOUND;
+}
+
+ACUTILS_HD_FUNC size_t AStringTemplate_renderedSize(const struct AStringTemplate *stringTemplate, const struct AStringTemplateValue *values)
+{
+    size_t i, renderedSize;
+    if(stringTemplate == NULL || (values == NULL && stringTemplate->slotCount > 0))
+        return ACUTILS_ASTRING_NOT_FOUND;
+    renderedSize = stringTemplate->literalSize;
+    for(i = 0; i < stringTemplate->partCount; ++i) {
+        size_t slot = stringTemplate->parts[i].slot;
+        if(slot != private_ACUtils_AStringTemplate_noSlot) {
+            if((values[slot].cstr == NULL && values[slot].len > 0) || values[slot].len >= ACUTILS_ASTRING_NOT_FOUND - renderedSize)
+                return ACUTILS_ASTRING_NOT_FOUND;
+            renderedSize += values[slot].len;
+        }
+    }
+    return renderedSize;
+}
+ACUTILS_HD_FUNC bool AStringTemplate_render(const struct AStringTemplate *stringTemplate, const struct AStringTemplateValue *values, struct AString *out)
+{
+    size_t i, oldSize, renderedSize = AStringTemplate_renderedSize(stringTemplate, values);
+    const char *oldBuffer;
+    if(out == NULL || renderedSize == ACUTILS_ASTRING_NOT_FOUND || renderedSize >= ((size_t) -1) - AString_size(out))
+        return false;
+    oldBuffer = AString_buffer(out);
+    oldSize = AString_size(out);
+    if(!AString_reserve(out, oldSize + renderedSize))
+        return false;
+    /* the appends only copy, the reserve made room for all of them */
+    for(i = 0; i < stringTemplate->partCount; ++i) {
+        const struct private_ACUtils_AStringTemplate_Part *part = stringTemplate->parts + i;
+        if(part->literalLength > 0)
+            AString_appendCString(out, stringTemplate->chars + part->literalOffset, part->literalLength);
+        if(part->slot != private_ACUtils_AStringTemplate_noSlot && values[part->slot].len > 0) {
+            const char *cstr = values[part->slot].cstr;
+            /* a value may be a part of out, which the reserve may have moved, the appends don't change the old chars */
+            if(cstr >= oldBuffer && cstr + values[part->slot].len <= oldBuffer + oldSize)
+                cstr = AString_buffer(out) + (cstr - oldBuffer);
+            AString_appendCString(out, cstr, values[part->slot].len);
+        }
+    }
+    return true;
+}
+
+#endif /* ACUTILS_ASTRINGTEMPLATE_H */
@@ -0,0 +1,260 @@
+#include "../include/ACUtilsTest/acheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ACUtils/aarena.h"
+#include "ACUtils/astring.h"
+
+static size_t private_ACUtilsTest_AArena_reallocCount = 0;
+static size_t private_ACUtilsTest_AArena_freeCount = 0;
+
+static void* private_ACUtilsTest_AArena_realloc(void *ptr, size_t size) {
+    void* tmp = realloc(ptr, size);
+    if(tmp != nullptr)
+        ++private_ACUtilsTest_AArena_reallocCount;
+    return tmp;
+}
+static void private_ACUtilsTest_AArena_free(void *ptr) {
+    if(ptr != nullptr)
+        ++private_ACUtilsTest_AArena_freeCount;
+    free(ptr);
+}
+
+A_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_AArena_IntArray, int);
+
+START_TEST(test_AArena_construct_destruct_valid)
+{
+    struct AArena *arena;
+    private_ACUtilsTest_AArena_reallocCount = private_ACUtilsTest_AArena_freeCount = 0;
+    arena = AArena_constructWithBlockSizeAndAllocator(256, private_ACUtilsTest_AArena_realloc, private_ACUtilsTest_AArena_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), 0);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(AArena_allocate(arena, 100));
+    ACUTILSTEST_ASSERT_PTR_NONNULL(AArena_allocate(arena, 1000));
+    AArena_destruct(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AArena_reallocCount, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AArena_reallocCount, private_ACUtilsTest_AArena_freeCount);
+}
+END_TEST
+START_TEST(test_AArena_construct_destruct_invalid)
+{
+    ACUTILSTEST_ASSERT_PTR_NULL(AArena_constructWithBlockSize(0));
+    ACUTILSTEST_ASSERT_PTR_NULL(AArena_constructWithBlockSizeAndAllocator(256, nullptr, free));
+    ACUTILSTEST_ASSERT_PTR_NULL(AArena_constructWithBlockSizeAndAllocator(256, realloc, nullptr));
+    AArena_destruct(nullptr); /* should do nothing */
+}
+END_TEST
+
+
+START_TEST(test_AArena_allocate_aligned)
+{
+    size_t i;
+    struct AArena *arena = AArena_construct();
+    for(i = 1; i < 64; ++i) {
+        void *ptr = AArena_allocate(arena, i);
+        ACUTILSTEST_ASSERT_PTR_NONNULL(ptr);
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) ptr) % sizeof(void*), 0);
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) ptr) % sizeof(double), 0);
+        memset(ptr, (int) i, i);
+    }
+    AArena_destruct(arena);
+}
+END_TEST
+START_TEST(test_AArena_allocate_nullptr)
+{
+    ACUTILSTEST_ASSERT_PTR_NULL(AArena_allocate(nullptr, 8));
+}
+END_TEST
+
+
+START_TEST(test_AArena_reallocate_lastAllocationGrowsInPlace)
+{
+    char *ptr, *tmp;
+    struct AArena *arena = AArena_construct();
+    ptr = (char*) AArena_reallocate(arena, nullptr, 8);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(ptr);
+    memcpy(ptr, "1234567", 8);
+    tmp = (char*) AArena_reallocate(arena, ptr, 64);
+    ACUTILSTEST_ASSERT_PTR_EQ(tmp, ptr);
+    ACUTILSTEST_ASSERT_STR_EQ(tmp, "1234567");
+    AArena_destruct(arena);
+}
+END_TEST
+START_TEST(test_AArena_reallocate_notLastAllocationCopies)
+{
+    char *ptr, *tmp;
+    struct AArena *arena = AArena_construct();
+    ptr = (char*) AArena_allocate(arena, 8);
+    memcpy(ptr, "1234567", 8);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(AArena_allocate(arena, 8));
+    tmp = (char*) AArena_reallocate(arena, ptr, 64);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(tmp);
+    ACUTILSTEST_ASSERT_PTR_NE(tmp, ptr);
+    ACUTILSTEST_ASSERT_STR_EQ(tmp, "1234567");
+    ACUTILSTEST_ASSERT_PTR_EQ(AArena_reallocate(arena, tmp, 16), tmp);
+    AArena_destruct(arena);
+}
+END_TEST
+
+
+START_TEST(test_AArena_deallocate_lastAllocationReleased)
+{
+    void *ptr1, *ptr2;
+    struct AArena *arena = AArena_construct();
+    ptr1 = AArena_allocate(arena, 24);
+    ptr2 = AArena_allocate(arena, 24);
+    AArena_deallocate(arena, ptr1); /* not the last allocation, nothing happens */
+    ACUTILSTEST_ASSERT((char*) AArena_allocate(arena, 24) > (char*) ptr2);
+    AArena_clear(arena);
+    ptr1 = AArena_allocate(arena, 24);
+    ptr2 = AArena_allocate(arena, 24);
+    AArena_deallocate(arena, ptr2);
+    AArena_deallocate(arena, ptr1);
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), 0);
+    ACUTILSTEST_ASSERT_PTR_EQ(AArena_allocate(arena, 24), ptr1);
+    AArena_deallocate(nullptr, ptr1);
+    AArena_deallocate(arena, nullptr);
+    AArena_destruct(arena);
+}
+END_TEST
+
+
+START_TEST(test_AArena_markRewind)
+{
+    size_t i, usedSize;
+    struct AArenaMark mark;
+    void *ptr;
+    struct AArena *arena;
+    private_ACUtilsTest_AArena_reallocCount = private_ACUtilsTest_AArena_freeCount = 0;
+    arena = AArena_constructWithBlockSizeAndAllocator(256, private_ACUtilsTest_AArena_realloc, private_ACUtilsTest_AArena_free);
+    AArena_allocate(arena, 16);
+    usedSize = AArena_usedSize(arena);
+    mark = AArena_mark(arena);
+    ptr = AArena_allocate(arena, 16);
+    for(i = 0; i < 100; ++i)
+        ACUTILSTEST_ASSERT_PTR_NONNULL(AArena_allocate(arena, 32));
+    ACUTILSTEST_ASSERT_UINT_GT(AArena_usedSize(arena), usedSize);
+    AArena_rewind(arena, mark);
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), usedSize);
+    ACUTILSTEST_ASSERT_PTR_EQ(AArena_allocate(arena, 16), ptr);
+    /* one released block of the default size is kept and reused after a rewind */
+    i = private_ACUtilsTest_AArena_reallocCount;
+    ACUTILSTEST_ASSERT_PTR_NONNULL(AArena_allocate(arena, 200));
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AArena_reallocCount, i);
+    AArena_destruct(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AArena_reallocCount, private_ACUtilsTest_AArena_freeCount);
+}
+END_TEST
+START_TEST(test_AArena_clear)
+{
+    size_t i;
+    struct AArena *arena = AArena_constructWithBlockSize(128);
+    AArena_clear(arena); /* should do nothing */
+    for(i = 0; i < 100; ++i)
+        AArena_allocate(arena, 32);
+    AArena_clear(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), 0);
+    AArena_clear(nullptr);
+    AArena_destruct(arena);
+}
+END_TEST
+
+
+START_TEST(test_AArena_allocator_withContainers)
+{
+    size_t i;
+    struct AString *string;
+    struct ASplittedString *splitted;
+    struct private_ACUtilsTest_AArena_IntArray *array;
+    struct ACUtilsAllocator allocator;
+    struct AArena *arena;
+    private_ACUtilsTest_AArena_reallocCount = private_ACUtilsTest_AArena_freeCount = 0;
+    arena = AArena_constructWithBlockSizeAndAllocator(4096, private_ACUtilsTest_AArena_realloc, private_ACUtilsTest_AArena_free);
+    allocator = AArena_allocator(arena);
+    ACUTILSTEST_ASSERT_PTR_EQ(allocator.context, arena);
+    string = AString_constructFromCStringWithAllocatorObject("a;bb;ccc;dddd", 13, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    splitted = AString_split(string, ';', false);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(splitted);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(splitted), 4);
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(ADynArray_get(splitted, 3)), "dddd");
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_AArena_IntArray, &allocator);
+    for(i = 0; i < 100; ++i) {
+        int value = (int) i;
+        ACUTILSTEST_ASSERT(ADynArray_append(array, value));
+    }
+    for(i = 0; i < 100; ++i)
+        ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, i), (int) i);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, ";eeeee", 6));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "a;bb;ccc;dddd;eeeee");
+    ACUTILSTEST_ASSERT_UINT_LE(private_ACUtilsTest_AArena_reallocCount, 2);
+    AArena_clear(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), 0);
+    AArena_destruct(arena);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AArena_reallocCount, private_ACUtilsTest_AArena_freeCount);
+    allocator = AArena_allocator(nullptr);
+    ACUTILSTEST_ASSERT_PTR_NULL(allocator.reallocator);
+}
+END_TEST
+
+START_TEST(test_AArena_allocator_reclaimSlack)
+{
+    size_t usedSize;
+    struct AString *string;
+    struct ACUtilsAllocator allocator;
+    struct AArena *arena = AArena_construct();
+    allocator = AArena_allocator(arena);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(allocator.usableSize);
+    string = AString_constructWithAllocatorObject(&allocator);
+    AString_setReclaimSlack(string, true);
+    ACUTILSTEST_ASSERT(AString_reserve(string, 9));
+    ACUTILSTEST_ASSERT_UINT_GE(AString_capacity(string), 16);
+    usedSize = AArena_usedSize(arena);
+    while(AString_size(string) < AString_capacity(string))
+        ACUTILSTEST_ASSERT(AString_append(string, 'x'));
+    ACUTILSTEST_ASSERT_UINT_EQ(AArena_usedSize(arena), usedSize);
+    AArena_destruct(arena);
+}
+END_TEST
+
+
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AArena_getTestSuite(void)
+{
+    Suite *s;
+    TCase *test_case_AArena_construct_destruct, *test_case_AArena_allocate, *test_case_AArena_reallocate,
+          *test_case_AArena_deallocate, *test_case_AArena_markRewind, *test_case_AArena_allocator;
+
+    s = suite_create("AArena Test Suite");
+
+    test_case_AArena_construct_destruct = tcase_create("AArena Test Case: AArena_construct / AArena_destruct");
+    tcase_add_test(test_case_AArena_construct_destruct, test_AArena_construct_destruct_valid);
+    tcase_add_test(test_case_AArena_construct_destruct, test_AArena_construct_destruct_invalid);
+    suite_add_tcase(s, test_case_AArena_construct_destruct);
+
+    test_case_AArena_allocate = tcase_create("AArena Test Case: AArena_allocate");
+    tcase_add_test(test_case_AArena_allocate, test_AArena_allocate_aligned);
+    tcase_add_test(test_case_AArena_allocate, test_AArena_allocate_nullptr);
+    suite_add_tcase(s, test_case_AArena_allocate);
+
+    test_case_AArena_reallocate = tcase_create("AArena Test Case: AArena_reallocate");
+    tcase_add_test(test_case_AArena_reallocate, test_AArena_reallocate_lastAllocationGrowsInPlace);
+    tcase_add_test(test_case_AArena_reallocate, test_AArena_reallocate_notLastAllocationCopies);
+    suite_add_tcase(s, test_case_AArena_reallocate);
+
+    test_case_AArena_deallocate = tcase_create("AArena Test Case: AArena_deallocate");
+    tcase_add_test(test_case_AArena_deallocate, test_AArena_deallocate_lastAllocationReleased);
+    suite_add_tcase(s, test_case_AArena_deallocate);
+
+    test_case_AArena_markRewind = tcase_create("AArena Test Case: AArena_mark / AArena_rewind / AArena_clear");
+    tcase_add_test(test_case_AArena_markRewind, test_AArena_markRewind);
+    tcase_add_test(test_case_AArena_markRewind, test_AArena_clear);
+    suite_add_tcase(s, test_case_AArena_markRewind);
+
+    test_case_AArena_allocator = tcase_create("AArena Test Case: AArena_allocator");
+    tcase_add_test(test_case_AArena_allocator, test_AArena_allocator_withContainers);
+    tcase_add_test(test_case_AArena_allocator, test_AArena_allocator_reclaimSlack);
+    suite_add_tcase(s, test_case_AArena_allocator);
+
+    return s;
+}
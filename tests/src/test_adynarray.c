@@ -2,6 +2,9 @@
 
 #include <string.h>
 #include <stdlib.h>
+#if defined(__unix__) || defined(__APPLE__)
+#   include <unistd.h>
+#endif
 
 #include "ACUtils/adynarray.h"
 
@@ -27,6 +30,57 @@ static void private_ACUtilsTest_ADynArray_free(void *ptr) {
     free(ptr);
 }
 
+struct private_ACUtilsTest_ADynArray_AllocatorContext
+{
+    size_t reallocCount;
+    size_t freeCount;
+};
+static void* private_ACUtilsTest_ADynArray_contextRealloc(void *context, void *ptr, size_t size)
+{
+    void *tmp = realloc(ptr, size);
+    if(tmp != nullptr)
+        ++((struct private_ACUtilsTest_ADynArray_AllocatorContext*) context)->reallocCount;
+    return tmp;
+}
+static void private_ACUtilsTest_ADynArray_contextFree(void *context, void *ptr)
+{
+    if(ptr != nullptr)
+        ++((struct private_ACUtilsTest_ADynArray_AllocatorContext*) context)->freeCount;
+    free(ptr);
+}
+
+/* hands out allocations rounded up to 32 bytes and reports the rounded size as usable */
+static size_t private_ACUtilsTest_ADynArray_slackLastSize = 0;
+static void* private_ACUtilsTest_ADynArray_slackRealloc(void *context, void *ptr, size_t size)
+{
+    (void) context; /* suppress unused warning */
+    private_ACUtilsTest_ADynArray_slackLastSize = (size + 31) / 32 * 32;
+    return realloc(ptr, private_ACUtilsTest_ADynArray_slackLastSize);
+}
+static void private_ACUtilsTest_ADynArray_slackFree(void *context, void *ptr)
+{
+    (void) context; /* suppress unused warning */
+    free(ptr);
+}
+static size_t private_ACUtilsTest_ADynArray_slackUsableSize(void *context, void *ptr)
+{
+    (void) context; /* suppress unused warning */
+    (void) ptr;
+    return private_ACUtilsTest_ADynArray_slackLastSize;
+}
+
+/* hands out allocations which are only 8 aligned (malloc aligns to 16) */
+static void* private_ACUtilsTest_ADynArray_misalignedRealloc(void *ptr, size_t size)
+{
+    char *tmp = (char*) realloc((ptr == nullptr) ? nullptr : ((char*) ptr) - 8, size + 8);
+    return (tmp == nullptr) ? nullptr : tmp + 8;
+}
+static void private_ACUtilsTest_ADynArray_misalignedFree(void *ptr)
+{
+    if(ptr != nullptr)
+        free(((char*) ptr) - 8);
+}
+
 static const size_t private_ACUtilsTest_ADynArray_capacityMin = 8;
 static const size_t private_ACUtilsTest_ADynArray_capacityMax = 32;
 static const double private_ACUtilsTest_ADynArray_capacityMul = 2;
@@ -44,6 +98,8 @@ struct private_ACUtilsTest_ADynArray_PointStruct
 
 A_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_ADynArray_PointArray, struct private_ACUtilsTest_ADynArray_PointStruct);
 A_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_ADynArray_CharArray, char);
+A_SMALL_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_ADynArray_IntArray, int, 16);
+A_SMALL_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_ADynArray_SmallPointArray, struct private_ACUtilsTest_ADynArray_PointStruct, 3);
 
 START_TEST(test_ADynArray_construct_destruct_valid)
 {
@@ -81,6 +137,43 @@ START_TEST(test_ADynArray_construct_destruct_withAllocator_invalid)
     ACUTILSTEST_ASSERT_PTR_NULL(array);
 }
 END_TEST
+START_TEST(test_ADynArray_construct_destruct_withAllocatorObject_valid)
+{
+    char c;
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    struct private_ACUtilsTest_ADynArray_AllocatorContext context = {0, 0};
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_ADynArray_contextRealloc, private_ACUtilsTest_ADynArray_contextFree};
+    allocator.context = &context;
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, private_ACUtilsTest_ADynArray_capacityMin);
+    ACUTILSTEST_ASSERT_PTR_NULL(ADynArray_reallocator(array));
+    ACUTILSTEST_ASSERT_PTR_NULL(ADynArray_deallocator(array));
+    ACUTILSTEST_ASSERT_PTR_EQ(ADynArray_allocator(array), &array->allocator);
+    ACUTILSTEST_ASSERT_PTR_EQ(array->allocator.context, &context);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 2);
+    for(c = '0'; c <= '8'; ++c)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, c));
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 3);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.freeCount, 2);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_withAllocatorObject_invalid)
+{
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    struct ACUtilsAllocator allocator = {nullptr, private_ACUtilsTest_ADynArray_contextFree};
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    allocator.reallocator = private_ACUtilsTest_ADynArray_contextRealloc;
+    allocator.deallocator = nullptr;
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, nullptr);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+}
+END_TEST
 START_TEST(test_ADynArray_construct_destruct_noMemoryAvailable)
 {
     struct private_ACUtilsTest_ADynArray_CharArray *array;
@@ -100,6 +193,210 @@ START_TEST(test_ADynArray_construct_destruct_noMemoryAvailable)
     ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 1);
 }
 END_TEST
+START_TEST(test_ADynArray_construct_destruct_compact_valid)
+{
+    char c;
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    array = ADynArray_constructCompactWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, private_ACUtilsTest_ADynArray_capacityMin);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % sizeof(double), 0);
+    for(c = '0'; c < '8'; ++c)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, c));
+    ACUTILSTEST_ASSERT(ADynArray_shrinkToFit(array));
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 1);
+    ACUTILSTEST_ASSERT(ADynArray_append(array, c));
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 9);
+    for(c = '0'; c <= '8'; ++c)
+        ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, c - '0'), c);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 2);
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    array = ADynArray_constructCompactWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 1);
+    array = ADynArray_constructCompact(struct private_ACUtilsTest_ADynArray_CharArray);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_compact_invalid)
+{
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    struct ACUtilsAllocator allocator = {nullptr, private_ACUtilsTest_ADynArray_contextFree};
+    array = ADynArray_constructCompactWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, nullptr, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructCompactWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, nullptr);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructCompactWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    private_ACUtilsTest_ADynArray_reallocFailCounter = 0;
+    private_ACUtilsTest_ADynArray_reallocFail = true;
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    array = ADynArray_constructCompactWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 0);
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_small_valid)
+{
+    size_t i;
+    struct private_ACUtilsTest_ADynArray_PointStruct point;
+    struct private_ACUtilsTest_ADynArray_SmallPointArray *array;
+    struct private_ACUtilsTest_ADynArray_AllocatorContext context = {0, 0};
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_ADynArray_contextRealloc, private_ACUtilsTest_ADynArray_contextFree};
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    array = ADynArray_constructSmallWithAllocator(struct private_ACUtilsTest_ADynArray_SmallPointArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 3);
+    ACUTILSTEST_ASSERT_PTR_EQ(array->buffer, array->smallBuffer);
+    for(i = 0; i < 3; ++i) {
+        point.x = (double) i;
+        point.y = (double) i * 2;
+        ACUTILSTEST_ASSERT(ADynArray_append(array, point));
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 1);
+    ACUTILSTEST_ASSERT(ADynArray_append(array, point));
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, private_ACUtilsTest_ADynArray_capacityMin);
+    ACUTILSTEST_ASSERT_PTR_NE(array->buffer, array->smallBuffer);
+    for(i = 0; i < 3; ++i)
+        ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, i).y, (int) i * 2);
+    ADynArray_remove(array, 0, 1);
+    ACUTILSTEST_ASSERT(ADynArray_shrinkToFit(array));
+    ACUTILSTEST_ASSERT_PTR_EQ(array->buffer, array->smallBuffer);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 1);
+    for(i = 0; i < 3; ++i)
+        ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, i).x, (int) (i < 2 ? i + 1 : 2));
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 2);
+    allocator.context = &context;
+    array = ADynArray_constructSmallWithAllocatorObject(struct private_ACUtilsTest_ADynArray_SmallPointArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.freeCount, 1);
+    array = ADynArray_constructSmall(struct private_ACUtilsTest_ADynArray_SmallPointArray);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_small_invalid)
+{
+    struct private_ACUtilsTest_ADynArray_PointStruct points[3] = {{1, 2}, {3, 4}, {5, 6}};
+    struct private_ACUtilsTest_ADynArray_SmallPointArray *array;
+    struct ACUtilsAllocator allocator = {nullptr, private_ACUtilsTest_ADynArray_contextFree};
+    array = ADynArray_constructSmallWithAllocator(struct private_ACUtilsTest_ADynArray_SmallPointArray, nullptr, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructSmallWithAllocator(struct private_ACUtilsTest_ADynArray_SmallPointArray, private_ACUtilsTest_ADynArray_realloc, nullptr);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructSmallWithAllocatorObject(struct private_ACUtilsTest_ADynArray_SmallPointArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    private_ACUtilsTest_ADynArray_reallocFailCounter = 1;
+    private_ACUtilsTest_ADynArray_reallocFail = true;
+    array = ADynArray_constructSmallWithAllocator(struct private_ACUtilsTest_ADynArray_SmallPointArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT(ADynArray_appendArray(array, points, 3));
+    ACUTILSTEST_ASSERT(!ADynArray_appendArray(array, points, 1));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_PTR_EQ(array->buffer, array->smallBuffer);
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_aligned_valid)
+{
+    size_t i, alignment;
+    struct private_ACUtilsTest_ADynArray_PointStruct point;
+    struct private_ACUtilsTest_ADynArray_PointArray *array;
+    struct private_ACUtilsTest_ADynArray_AllocatorContext context = {0, 0};
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_ADynArray_contextRealloc, private_ACUtilsTest_ADynArray_contextFree, &context};
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    for(alignment = 1; alignment <= 128; alignment *= 2) {
+        array = ADynArray_constructAlignedWithAllocator(struct private_ACUtilsTest_ADynArray_PointArray, alignment,
+                                                        private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+        ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % alignment, 0);
+        for(i = 0; i < 100; ++i) {
+            point.x = (double) i;
+            point.y = (double) i * 2;
+            ACUTILSTEST_ASSERT(ADynArray_append(array, point));
+            ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % alignment, 0);
+        }
+        ACUTILSTEST_ASSERT(ADynArray_reserve(array, 1000));
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % alignment, 0);
+        ADynArray_remove(array, 0, 90);
+        ACUTILSTEST_ASSERT(ADynArray_shrinkToFit(array));
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % alignment, 0);
+        for(i = 0; i < 10; ++i)
+            ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, i).y, (int) (i + 90) * 2);
+        ADynArray_destruct(array);
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_freeCount, 16);
+    array = ADynArray_constructAlignedWithAllocatorObject(struct private_ACUtilsTest_ADynArray_PointArray, 64, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 64, 0);
+    ADynArray_setReclaimSlack(array, true);
+    ADynArray_setShrinkPolicy(array, 4);
+    for(i = 0; i < 1000; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, point));
+    ADynArray_remove(array, 10, -1);
+    ACUTILSTEST_ASSERT_UINT_LT(array->capacity, 1000);
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 64, 0);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.freeCount, 2);
+    array = ADynArray_constructAligned(struct private_ACUtilsTest_ADynArray_PointArray, 32);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 32, 0);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_aligned_misalignedAllocator)
+{
+    size_t i;
+    struct private_ACUtilsTest_ADynArray_PointStruct point = {1, 2};
+    struct private_ACUtilsTest_ADynArray_PointArray *array;
+    array = ADynArray_constructAlignedWithAllocator(struct private_ACUtilsTest_ADynArray_PointArray, 16,
+                                                    private_ACUtilsTest_ADynArray_misalignedRealloc,
+                                                    private_ACUtilsTest_ADynArray_misalignedFree);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 16, 0);
+    for(i = 0; i < 100; ++i) {
+        ACUTILSTEST_ASSERT(ADynArray_append(array, point));
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 16, 0);
+    }
+    ACUTILSTEST_ASSERT(ADynArray_shrinkToFit(array));
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) array->buffer) % 16, 0);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_construct_destruct_aligned_invalid)
+{
+    struct private_ACUtilsTest_ADynArray_PointArray *array;
+    struct ACUtilsAllocator allocator = {nullptr, private_ACUtilsTest_ADynArray_contextFree};
+    array = ADynArray_constructAligned(struct private_ACUtilsTest_ADynArray_PointArray, 0);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructAligned(struct private_ACUtilsTest_ADynArray_PointArray, 48);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructAligned(struct private_ACUtilsTest_ADynArray_PointArray, 256);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructAlignedWithAllocator(struct private_ACUtilsTest_ADynArray_PointArray, 64, nullptr, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+    array = ADynArray_constructAlignedWithAllocatorObject(struct private_ACUtilsTest_ADynArray_PointArray, 64, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(array);
+}
+END_TEST
 START_TEST(test_ADynArray_construct_destruct_nullptr)
 {
     struct private_ACUtilsTest_ADynArray_CharArray *array = nullptr;
@@ -125,6 +422,60 @@ START_TEST(test_ADynArray_setGrowStrategy)
     ADynArray_setGrowStrategy(arrayPtr, private_ACUtilsTest_ADynArray_growStrategy);
 }
 
+START_TEST(test_ADynArray_growStrategyGeneric)
+{
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(0, 8, -1, 2, 1000), 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(8, 8, -1, 2, 1000), 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(9, 8, -1, 2, 1000), 16);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(129, 8, -1, 2, 1000), 256);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(129, 8, 200, 2, 1000), 200);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(5000, 8, -1, 2, 1000), 6000);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(25, 3, -1, 3, 1000), 27);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(13, 8, -1, 1.5, 1000), 18);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(((size_t) -1) - 10, 8, -1, 2, 1000), (size_t) -1);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtils_ADynArray_growStrategyGeneric(((size_t) -1) / 2 + 2, 8, -1, 3, 5), ((size_t) -1) / 2 + 7);
+}
+END_TEST
+
+START_TEST(test_ADynArray_growStrategyPresets)
+{
+    size_t i, pageSize = 4096;
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+#ifdef _SC_PAGESIZE
+    pageSize = (size_t) sysconf(_SC_PAGESIZE);
+#endif
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyPageRounded(0, 4), 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyPageRounded(100, 4), 128);
+    /* the default strategy gives 2048 elements, buffers of at least one page of the real page size are rounded up to
+     * whole pages */
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyPageRounded(1025, 24),
+                               (2048 * 24 < pageSize) ? 2048 : (2048 * 24 + pageSize - 1) / pageSize * pageSize / 24);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyPageRounded(1025, 3),
+                               (2048 * 3 < pageSize) ? 2048 : (2048 * 3 + pageSize - 1) / pageSize * pageSize / 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyOneAndAHalf(0, 1), 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyOneAndAHalf(13, 1), 18);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyOneAndAHalf(28, 1), 40);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(0, 4), 4);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(5, 4), 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(33, 4), 40);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(129, 1), 160);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(257, 1), 320);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategySizeClass(1, 100), 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyLinearChunk(0, 4), 1024);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyLinearChunk(1025, 4), 2048);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_growStrategyLinearChunk(3, 5000), 3);
+    array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_CharArray);
+    ADynArray_setGrowStrategy(array, ADynArray_growStrategySizeClass);
+    for(i = 0; i < 1000; ++i) {
+        char c = (char) i;
+        ACUTILSTEST_ASSERT(ADynArray_append(array, c));
+        if(array->capacity > private_ACUtilsTest_ADynArray_capacityMin)
+            ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, ADynArray_growStrategySizeClass(array->capacity, 1));
+    }
+    ADynArray_destruct(array);
+}
+END_TEST
+
 
 START_TEST(test_ADynArray_size_valid)
 {
@@ -252,6 +603,30 @@ START_TEST(test_ADynArray_reserve_success_notEnoughCapacity)
     array.deallocator(array.buffer);
 }
 END_TEST
+START_TEST(test_ADynArray_reserve_success_reclaimSlack)
+{
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_ADynArray_slackRealloc, private_ACUtilsTest_ADynArray_slackFree,
+                                         nullptr, private_ACUtilsTest_ADynArray_slackUsableSize};
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_ADynArray_CharArray, &allocator);
+    ADynArray_setGrowStrategy(array, nullptr);
+    ACUTILSTEST_ASSERT(ADynArray_reserve(array, 9));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 9);
+    ADynArray_setReclaimSlack(array, true);
+    ACUTILSTEST_ASSERT(ADynArray_reserve(array, 40));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 64);
+    ADynArray_setReclaimSlack(array, false);
+    ACUTILSTEST_ASSERT(ADynArray_reserve(array, 70));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 70);
+    ADynArray_destruct(array);
+    array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_CharArray);
+    ADynArray_setReclaimSlack(array, true);
+    ACUTILSTEST_ASSERT(ADynArray_reserve(array, 100));
+    ACUTILSTEST_ASSERT_UINT_GE(array->capacity, 100);
+    ADynArray_destruct(array);
+    ADynArray_setReclaimSlack(nullptr, true);
+}
+END_TEST
 START_TEST(test_ADynArray_reserve_failure_biggerThanMaxCapacity)
 {
     size_t i;
@@ -467,6 +842,67 @@ START_TEST(test_ADynArray_shrinkToFit_failure_nullptr)
 END_TEST
 
 
+START_TEST(test_ADynArray_resize_zeroFill)
+{
+    size_t i;
+    char c = 'x';
+    struct private_ACUtilsTest_ADynArray_PointArray *array;
+    struct private_ACUtilsTest_ADynArray_CharArray *charArray;
+    array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_PointArray);
+    ACUTILSTEST_ASSERT(ADynArray_resize(array, 100000, true));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 100000);
+    ACUTILSTEST_ASSERT_UINT_GE(array->capacity, 100000);
+    for(i = 0; i < array->size; ++i) {
+        if(ADynArray_get(array, i).x != 0 || ADynArray_get(array, i).y != 0)
+            break;
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(i, 100000);
+    ADynArray_destruct(array);
+
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    charArray = ADynArray_constructAlignedWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, 64,
+                                                        private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT(ADynArray_setRange(charArray, 0, 3, c));
+    ACUTILSTEST_ASSERT(ADynArray_resize(charArray, 5000, true));
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) charArray->buffer) % 64, 0);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(charArray, 2), 'x');
+    for(i = 3; i < charArray->size; ++i) {
+        if(ADynArray_get(charArray, i) != 0)
+            break;
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(i, 5000);
+    ADynArray_destruct(charArray);
+
+    charArray = ADynArray_constructAligned(struct private_ACUtilsTest_ADynArray_CharArray, 64);
+    ACUTILSTEST_ASSERT(ADynArray_resize(charArray, 5000, true));
+    ACUTILSTEST_ASSERT_UINT_EQ(((size_t) charArray->buffer) % 64, 0);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(charArray, 4999), 0);
+    ACUTILSTEST_ASSERT(ADynArray_resize(charArray, 10, false));
+    ACUTILSTEST_ASSERT_UINT_EQ(charArray->size, 10);
+    ADynArray_setShrinkPolicy(charArray, 4);
+    ACUTILSTEST_ASSERT(ADynArray_resize(charArray, 9, false));
+    ACUTILSTEST_ASSERT_UINT_LT(charArray->capacity, 5000);
+    ACUTILSTEST_ASSERT(ADynArray_resize(charArray, 20, false));
+    ACUTILSTEST_ASSERT_UINT_EQ(charArray->size, 20);
+    ADynArray_destruct(charArray);
+}
+END_TEST
+START_TEST(test_ADynArray_resize_failure)
+{
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    array = ADynArray_constructWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray,
+                                             private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    private_ACUtilsTest_ADynArray_reallocFailCounter = 0;
+    private_ACUtilsTest_ADynArray_reallocFail = true;
+    ACUTILSTEST_ASSERT(ADynArray_resize(array, 4, true));
+    ACUTILSTEST_ASSERT(!ADynArray_resize(array, 1000, true));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 4);
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT(!ADynArray_resize(array, 10, true));
+}
+END_TEST
 START_TEST(test_ADynArray_clear)
 {
     struct private_ACUtilsTest_ADynArray_CharArray array = {.reallocator = private_ACUtilsTest_ADynArray_realloc, .deallocator = private_ACUtilsTest_ADynArray_free};
@@ -575,6 +1011,263 @@ START_TEST(test_ADynArray_remove_indexBeyoundBounds)
     array.deallocator(array.buffer);
 }
 END_TEST
+START_TEST(test_ADynArray_remove_shrinkPolicy)
+{
+    size_t i;
+    struct private_ACUtilsTest_ADynArray_CharArray *array;
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    array = ADynArray_constructWithAllocator(struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_shrinkPolicy(array), 0);
+    for(i = 0; i < 1000; ++i) {
+        char c = (char) i;
+        ADynArray_append(array, c);
+    }
+    ADynArray_remove(array, 10, -1);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 1024);
+    ADynArray_setShrinkPolicy(array, 4);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_shrinkPolicy(array), 4);
+    for(i = 10; i < 300; ++i) {
+        char c = (char) i;
+        ADynArray_append(array, c);
+    }
+    ADynArray_remove(array, 0, 40);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 260);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 1024);
+    private_ACUtilsTest_ADynArray_reallocCount = 0;
+    ADynArray_remove(array, 0, 5);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 512);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 0), (char) 45);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 254), (char) 299);
+    /* oscillating between 100 and 255 elements settles at capacity 256 and doesn't reallocate any more */
+    for(i = 0; i < 10; ++i) {
+        ADynArray_remove(array, 100, -1);
+        while(array->size < 255)
+            ADynArray_append(array, array->buffer[0]);
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, 256);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, 2);
+    ADynArray_clear(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->capacity, private_ACUtilsTest_ADynArray_capacityMin);
+    ADynArray_setShrinkPolicy(array, 0);
+    ADynArray_setShrinkPolicy((struct private_ACUtilsTest_ADynArray_CharArray*) nullptr, 4);
+    ADynArray_destruct(array);
+}
+END_TEST
+static bool private_ACUtilsTest_ADynArray_isMultipleOf(const void *element, void *context)
+{
+    return *(const int*) element % *(int*) context == 0;
+}
+/* a stateful predicate, context counts the calls and every third call (starting with the first) removes */
+static bool private_ACUtilsTest_ADynArray_isEveryThirdCall(const void *element, void *context)
+{
+    (void) element; /* suppress unused warning */
+    return (*(size_t*) context)++ % 3 == 0;
+}
+START_TEST(test_ADynArray_swapRemove)
+{
+    int i;
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    for(i = 0; i < 5; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ADynArray_swapRemove(array, 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 4);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 1), 4);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 3), 3);
+    ADynArray_swapRemove(array, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 2), 2);
+    ADynArray_swapRemove(array, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ADynArray_destruct(array);
+    array = nullptr;
+    ADynArray_swapRemove(array, 0);
+}
+END_TEST
+START_TEST(test_ADynArray_removeIf)
+{
+    int i, divisor = 3;
+    size_t callCount;
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    for(i = 0; i < 100000; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removeIf(array, private_ACUtilsTest_ADynArray_isMultipleOf, &divisor), 33334);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 66666);
+    for(i = 0; i < 66666 && ADynArray_get(array, i) == i / 2 * 3 + i % 2 + 1; ++i);
+    ACUTILSTEST_ASSERT_INT_EQ(i, 66666);
+    divisor = 1;
+    ADynArray_setShrinkPolicy(array, 4);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removeIf(array, private_ACUtilsTest_ADynArray_isMultipleOf, &divisor), 66666);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    ACUTILSTEST_ASSERT_UINT_LT(array->capacity, 100000);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removeIf(array, nullptr, nullptr), 0);
+    /* predicate is called exactly once per element, front to back */
+    for(i = 0; i < 20; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    callCount = 0;
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removeIf(array, private_ACUtilsTest_ADynArray_isEveryThirdCall, &callCount), 7);
+    ACUTILSTEST_ASSERT_UINT_EQ(callCount, 20);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 13);
+    for(i = 0; i < 13 && ADynArray_get(array, i) == i / 2 * 3 + i % 2 + 1; ++i);
+    ACUTILSTEST_ASSERT_INT_EQ(i, 13);
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removeIf(array, private_ACUtilsTest_ADynArray_isMultipleOf, &divisor), 0);
+}
+END_TEST
+START_TEST(test_ADynArray_markRemoved_lazy)
+{
+    int i;
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    for(i = 0; i < 1000; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    /* without lazy removal the element is removed immediately */
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 999));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 999);
+    ACUTILSTEST_ASSERT(ADynArray_setLazyRemoval(array, true, 0));
+    for(i = 0; i < 999; i += 3)
+        ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, i));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 3));
+    ACUTILSTEST_ASSERT(!ADynArray_markRemoved(array, 999));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 333);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 999);
+    ACUTILSTEST_ASSERT(ADynArray_isRemoved(array, 6));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 7));
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 7), 7);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_buffer(array)[0], 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 666);
+    for(i = 0; i < 666 && ADynArray_get(array, i) == i / 2 * 3 + i % 2 + 1; ++i);
+    ACUTILSTEST_ASSERT_INT_EQ(i, 666);
+    /* with lazy removal remove only marks */
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 0));
+    ADynArray_remove(array, 0, 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 666);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 2);
+    ADynArray_compact(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 664);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 0), 4);
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 1));
+    ADynArray_clear(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 1));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 0));
+    ACUTILSTEST_ASSERT(ADynArray_setLazyRemoval(array, false, 0));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 0));
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT(!ADynArray_setLazyRemoval(array, true, 0));
+    ACUTILSTEST_ASSERT(!ADynArray_markRemoved(array, 0));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 0));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    ADynArray_compact(array);
+}
+END_TEST
+START_TEST(test_ADynArray_markRemoved_indices)
+{
+    int i, values[4] = {10, 20, 30, 40}, inserted = 77;
+    struct ACUtilsEdit edit = {3, 2, nullptr, 1};
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    edit.insertData = &inserted;
+    ACUTILSTEST_ASSERT(ADynArray_appendArray(array, values, 4));
+    ACUTILSTEST_ASSERT(ADynArray_setLazyRemoval(array, true, 0));
+    /* while elements are marked, all indices refer to the uncompacted elements */
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 1));
+    i = 99;
+    ACUTILSTEST_ASSERT(ADynArray_insert(array, 3, i));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 5);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 3), 99);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 4), 40);
+    ACUTILSTEST_ASSERT(ADynArray_isRemoved(array, 1));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 3));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 0));
+    ADynArray_remove(array, 4, 1);
+    ADynArray_swapRemove(array, 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 5);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 4);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 4), 40);
+    /* setting a marked element keeps it again */
+    i = 21;
+    ACUTILSTEST_ASSERT(ADynArray_set(array, 1, i));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 1));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 3);
+    /* inserting in front of marked elements moves their marks along */
+    i = 5;
+    ACUTILSTEST_ASSERT(ADynArray_insert(array, 0, i));
+    ACUTILSTEST_ASSERT(ADynArray_isRemoved(array, 1));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 2));
+    ACUTILSTEST_ASSERT(ADynArray_isRemoved(array, 3));
+    ACUTILSTEST_ASSERT(!ADynArray_isRemoved(array, 4));
+    ACUTILSTEST_ASSERT(ADynArray_isRemoved(array, 5));
+    /* [5, 10*, 21, 30*, 99, 40*]: the edit replaces 30 (already marked) and 99 with 77 */
+    ACUTILSTEST_ASSERT(ADynArray_applyEdits(array, &edit, 1));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 0), 5);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 1), 21);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 2), 77);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_markRemoved_compactDivisor)
+{
+    int i;
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    struct private_ACUtilsTest_ADynArray_IntArray *copy = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    for(i = 0; i < 100; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT(ADynArray_setLazyRemoval(array, true, 4));
+    for(i = 0; i < 24; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 99 - i));
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 24);
+    ACUTILSTEST_ASSERT(ADynArray_insertADynArray(copy, 0, array));
+    ACUTILSTEST_ASSERT_UINT_EQ(copy->size, 76);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    /* appends keep the marks until they make up a quarter of the size */
+    for(i = 0; i < 18; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, i));
+    i = 100;
+    ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 77);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 18);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 76), 100);
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 18));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 19));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 77);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 20);
+    i = 101;
+    ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 58);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 0);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 0), 20);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 56), 100);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 57), 101);
+    /* marking never compacts, so ascending indices stay valid across the threshold */
+    ADynArray_clear(array);
+    for(i = 0; i < 20; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    for(i = 1; i < 12; i += 2)
+        ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, i));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 20);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_removedCount(array), 6);
+    ADynArray_compact(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 14);
+    for(i = 0; i < 14 && ADynArray_get(array, i) == (i < 6 ? i * 2 : i + 6); ++i);
+    ACUTILSTEST_ASSERT_INT_EQ(i, 14);
+    /* arrays smaller than compactDivisor don't compact on every mark */
+    ADynArray_clear(array);
+    for(i = 0; i < 3; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_append(array, i));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 0));
+    ACUTILSTEST_ASSERT(ADynArray_markRemoved(array, 1));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_buffer(array)[0], 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 1);
+    ADynArray_destruct(copy);
+    ADynArray_destruct(array);
+}
+END_TEST
 START_TEST(test_ADynArray_remove_nullptr)
 {
     struct private_ACUtilsTest_ADynArray_CharArray *arrayPtr = nullptr;
@@ -850,6 +1543,34 @@ START_TEST(test_ADynArray_insertArray_success_bufferExpanded)
     array.deallocator(array.buffer);
 }
 END_TEST
+START_TEST(test_ADynArray_insertArray_success_bufferExpandedSmall)
+{
+    size_t i;
+    struct private_ACUtilsTest_ADynArray_PointStruct points[3] = {{1, 2}, {3, 4}, {5, 6}};
+    struct private_ACUtilsTest_ADynArray_SmallPointArray *array;
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    private_ACUtilsTest_ADynArray_reallocCount = private_ACUtilsTest_ADynArray_freeCount = 0;
+    array = ADynArray_constructSmallWithAllocator(struct private_ACUtilsTest_ADynArray_SmallPointArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT(ADynArray_appendArray(array, points, 3));
+    ACUTILSTEST_ASSERT(ADynArray_insertArray(array, 1, points, 3));
+    ACUTILSTEST_ASSERT_PTR_NE(array->buffer, array->smallBuffer);
+    for(i = 0; i < 20; ++i)
+        ACUTILSTEST_ASSERT(ADynArray_insertArray(array, 2, points, 3));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 66);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 0).x, 1);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 1).x, 1);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 2).x, 1);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 4).x, 5);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 62).y, 4);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 63).y, 6);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 64).y, 4);
+    ACUTILSTEST_ASSERT_INT_EQ((int) ADynArray_get(array, 65).y, 6);
+    /* every growth allocates a new buffer and frees the old one (except the inline one) */
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, private_ACUtilsTest_ADynArray_freeCount + 2);
+    ADynArray_destruct(array);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_ADynArray_reallocCount, private_ACUtilsTest_ADynArray_freeCount);
+}
+END_TEST
 START_TEST(test_ADynArray_insertArray_success_nullptrArray)
 {
     struct private_ACUtilsTest_ADynArray_CharArray array = {.reallocator = private_ACUtilsTest_ADynArray_realloc, .deallocator = private_ACUtilsTest_ADynArray_free};
@@ -1599,6 +2320,94 @@ START_TEST(test_ADynArray_appendADynArray_failure_nullptrDestArray)
 END_TEST
 
 
+START_TEST(test_ADynArray_insertUninitialized_valid)
+{
+    size_t i;
+    struct private_ACUtilsTest_ADynArray_PointStruct *point;
+    struct private_ACUtilsTest_ADynArray_PointArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_PointArray);
+    for(i = 0; i < 100; ++i) {
+        point = ADynArray_emplaceBack(array);
+        ACUTILSTEST_ASSERT_PTR_NONNULL(point);
+        point->x = (double) i;
+        point->y = -(double) i;
+    }
+    point = ADynArray_appendUninitialized(array, 1000);
+    ACUTILSTEST_ASSERT(point == array->buffer + 100);
+    for(i = 0; i < 1000; ++i)
+        point[i].x = point[i].y = 0.5;
+    point = ADynArray_insertUninitialized(array, 10, 2);
+    ACUTILSTEST_ASSERT(point == array->buffer + 10);
+    point[0].x = point[1].x = point[0].y = point[1].y = -1;
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 1102);
+    ACUTILSTEST_ASSERT(ADynArray_get(array, 9).x == 9 && ADynArray_get(array, 11).y == -1);
+    ACUTILSTEST_ASSERT(ADynArray_get(array, 12).x == 10 && ADynArray_get(array, 101).y == -99);
+    ACUTILSTEST_ASSERT(ADynArray_get(array, 102).x == 0.5 && ADynArray_get(array, 1101).y == 0.5);
+    ACUTILSTEST_ASSERT(ADynArray_insertUninitialized(array, 5000, 0) == array->buffer + 1102);
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 1102);
+    ADynArray_destruct(array);
+}
+END_TEST
+START_TEST(test_ADynArray_insertUninitialized_invalid)
+{
+    struct private_ACUtilsTest_ADynArray_CharArray *array = ADynArray_constructWithAllocator(
+            struct private_ACUtilsTest_ADynArray_CharArray, private_ACUtilsTest_ADynArray_realloc, private_ACUtilsTest_ADynArray_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    private_ACUtilsTest_ADynArray_reallocFail = true;
+    private_ACUtilsTest_ADynArray_reallocFailCounter = 0;
+    ACUTILSTEST_ASSERT_PTR_NULL(ADynArray_appendUninitialized(array, 1000));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 0);
+    private_ACUtilsTest_ADynArray_reallocFail = false;
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT_PTR_NULL(ADynArray_emplaceBack(array));
+    ACUTILSTEST_ASSERT_PTR_NULL(ADynArray_appendUninitialized(array, 0));
+}
+END_TEST
+
+/* writes the following numbers times three, context points to the next number and the last number to write */
+static size_t private_ACUtilsTest_ADynArray_generateTriples(void *elements, size_t count, void *context)
+{
+    size_t i;
+    int *range = (int*) context;
+    for(i = 0; i < count && range[0] < range[1]; ++i, ++range[0])
+        ((int*) elements)[i] = range[0] * 3;
+    return i;
+}
+/* writes nothing, context counts the calls */
+static size_t private_ACUtilsTest_ADynArray_countGeneratorCalls(void *elements, size_t count, void *context)
+{
+    (void) elements; /* suppress unused warning */
+    (void) count;
+    ++*(size_t*) context;
+    return 0;
+}
+START_TEST(test_ADynArray_appendGenerate)
+{
+    int i, range[2] = {0, 100000};
+    size_t callCount;
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    ACUTILSTEST_ASSERT(ADynArray_append(array, range[1]));
+    ACUTILSTEST_ASSERT(ADynArray_appendGenerate(array, 60000, private_ACUtilsTest_ADynArray_generateTriples, range));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 60001);
+    ACUTILSTEST_ASSERT(ADynArray_appendGenerate(array, 60000, private_ACUtilsTest_ADynArray_generateTriples, range));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 100001);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 0), 100000);
+    for(i = 0; i < 100000 && ADynArray_get(array, i + 1) == i * 3; ++i);
+    ACUTILSTEST_ASSERT_INT_EQ(i, 100000);
+    /* a count of 0 is a no-op which doesn't call the generator */
+    callCount = 0;
+    ACUTILSTEST_ASSERT(ADynArray_appendGenerate(array, 0, private_ACUtilsTest_ADynArray_countGeneratorCalls, &callCount));
+    ACUTILSTEST_ASSERT_UINT_EQ(callCount, 0);
+    ACUTILSTEST_ASSERT(ADynArray_appendGenerate(array, 1, private_ACUtilsTest_ADynArray_countGeneratorCalls, &callCount));
+    ACUTILSTEST_ASSERT_UINT_EQ(callCount, 1);
+    ACUTILSTEST_ASSERT(!ADynArray_appendGenerate(array, 10, nullptr, range));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 100001);
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT(!ADynArray_appendGenerate(array, 10, private_ACUtilsTest_ADynArray_generateTriples, range));
+}
+END_TEST
+
 START_TEST(test_ADynArray_set_success_indexInBounds)
 {
     struct private_ACUtilsTest_ADynArray_CharArray array = {.reallocator = private_ACUtilsTest_ADynArray_realloc, .deallocator = private_ACUtilsTest_ADynArray_free};
@@ -1885,6 +2694,43 @@ START_TEST(test_ADynArray_setRange_success_indexAndRangeBeyondSize_bufferExpande
     array.deallocator(array.buffer);
 }
 END_TEST
+START_TEST(test_ADynArray_setRange_success_elementSizes)
+{
+    size_t i, sizes[] = {1, 2, 3, 4, 5, 8, 12, 16, 24, 100, 10000};
+    size_t count, countIndex, sizeIndex;
+    size_t counts[] = {1, 2, 7, 1000, 5000};
+    unsigned char value[10000];
+    for(sizeIndex = 0; sizeIndex < sizeof(sizes) / sizeof(sizes[0]); ++sizeIndex) {
+        for(countIndex = 0; countIndex < sizeof(counts) / sizeof(counts[0]); ++countIndex) {
+            size_t typeSize = sizes[sizeIndex];
+            unsigned char *buffer;
+            count = (typeSize > 100) ? counts[countIndex] % 8 + 1 : counts[countIndex];
+            buffer = (unsigned char*) malloc(count * typeSize + 1);
+            for(i = 0; i < typeSize; ++i)
+                value[i] = (unsigned char) (i * 7 + sizeIndex);
+            buffer[count * typeSize] = 0xAB;
+            private_ACUtils_ADynArray_fill(buffer, value, count, typeSize);
+            for(i = 0; i < count * typeSize; ++i) {
+                if(buffer[i] != value[i % typeSize])
+                    break;
+            }
+            ACUTILSTEST_ASSERT_UINT_EQ(i, count * typeSize);
+            ACUTILSTEST_ASSERT_UINT_EQ(buffer[count * typeSize], 0xAB);
+            /* byte patterns and values from inside the filled range */
+            memset(value, 0xFF, typeSize);
+            private_ACUtils_ADynArray_fill(buffer, value, count, typeSize);
+            ACUTILSTEST_ASSERT_UINT_EQ(buffer[count * typeSize - 1], 0xFF);
+            buffer[count * typeSize - 1] = 1;
+            private_ACUtils_ADynArray_fill(buffer, buffer + (count - 1) * typeSize, count, typeSize);
+            ACUTILSTEST_ASSERT_UINT_EQ(buffer[typeSize - 1], 1);
+            ACUTILSTEST_ASSERT_UINT_EQ(buffer[count * typeSize - 1], 1);
+            if(typeSize > 1)
+                ACUTILSTEST_ASSERT_UINT_EQ(buffer[count * typeSize - 2], 0xFF);
+            free(buffer);
+        }
+    }
+}
+END_TEST
 START_TEST(test_ADynArray_setRange_failure_indexInBoundsRangeBeyondSize_bufferExpansionFailed)
 {
     struct private_ACUtilsTest_ADynArray_CharArray array = {.reallocator = private_ACUtilsTest_ADynArray_realloc, .deallocator = private_ACUtilsTest_ADynArray_free};
@@ -1945,6 +2791,80 @@ START_TEST(test_ADynArray_setRange_failure_nullptr)
 END_TEST
 
 
+START_TEST(test_ADynArray_applyEdits_matchesSingleEdits)
+{
+    size_t round, i, j;
+    int insertData[64];
+    struct ACUtilsEdit edits[16];
+    struct private_ACUtilsTest_ADynArray_IntArray *array, *expected;
+    unsigned long random = 12345;
+    for(i = 0; i < 64; ++i)
+        insertData[i] = -(int) i - 1;
+    for(round = 0; round < 500; ++round) {
+        size_t size, editCount, position = 0;
+        array = ADynArray_constructSmall(struct private_ACUtilsTest_ADynArray_IntArray);
+        expected = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+        random = random * 1103515245 + 12345;
+        size = (random >> 8) % 40;
+        for(i = 0; i < size; ++i) {
+            int value = (int) i;
+            ACUTILSTEST_ASSERT(ADynArray_append(array, value));
+        }
+        if(round % 2 == 0)
+            ACUTILSTEST_ASSERT(ADynArray_reserve(array, 100));
+        random = random * 1103515245 + 12345;
+        editCount = (random >> 8) % 16;
+        for(i = 0; i < editCount; ++i) {
+            random = random * 1103515245 + 12345;
+            edits[i].index = position + ((random >> 8) % 4 == 0 ? 0 : (random >> 12) % (size - position + 1));
+            random = random * 1103515245 + 12345;
+            edits[i].removeCount = (random >> 8) % (size - edits[i].index + 1) / 2;
+            edits[i].insertCount = (random >> 16) % 8;
+            edits[i].insertData = insertData + (random >> 20) % 32;
+            position = edits[i].index + edits[i].removeCount;
+        }
+        ACUTILSTEST_ASSERT(ADynArray_appendADynArray(expected, array));
+        for(i = editCount; i > 0; --i) {
+            ADynArray_remove(expected, edits[i - 1].index, edits[i - 1].removeCount);
+            ACUTILSTEST_ASSERT(ADynArray_insertArray(expected, edits[i - 1].index, edits[i - 1].insertData, edits[i - 1].insertCount));
+        }
+        ACUTILSTEST_ASSERT(ADynArray_applyEdits(array, edits, editCount));
+        ACUTILSTEST_ASSERT_UINT_EQ(array->size, expected->size);
+        for(j = 0; j < expected->size && ADynArray_get(array, j) == ADynArray_get(expected, j); ++j);
+        ACUTILSTEST_ASSERT_UINT_EQ(j, expected->size);
+        ADynArray_destruct(array);
+        ADynArray_destruct(expected);
+    }
+}
+END_TEST
+START_TEST(test_ADynArray_applyEdits_invalid)
+{
+    int data[3] = {7, 8, 9};
+    struct ACUtilsEdit edits[2] = {{2, 1, nullptr, 0}, {1, 0, nullptr, 0}};
+    struct private_ACUtilsTest_ADynArray_IntArray *array = ADynArray_construct(struct private_ACUtilsTest_ADynArray_IntArray);
+    ACUTILSTEST_ASSERT(ADynArray_appendArray(array, data, 3));
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, edits, 2)); /* not sorted */
+    edits[1].index = 2;
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, edits, 2)); /* overlapping */
+    edits[1].index = 3;
+    edits[1].removeCount = 1;
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, edits, 2)); /* beyond the end */
+    edits[1].removeCount = 0;
+    edits[1].insertCount = 1;
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, edits, 2)); /* no data */
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 2), 9);
+    edits[1].insertData = data;
+    ACUTILSTEST_ASSERT(ADynArray_applyEdits(array, edits, 2));
+    ACUTILSTEST_ASSERT_UINT_EQ(array->size, 3);
+    ACUTILSTEST_ASSERT_INT_EQ(ADynArray_get(array, 2), 7);
+    ACUTILSTEST_ASSERT(ADynArray_applyEdits(array, nullptr, 0));
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, nullptr, 1));
+    ADynArray_destruct(array);
+    array = nullptr;
+    ACUTILSTEST_ASSERT(!ADynArray_applyEdits(array, edits, 2));
+}
+END_TEST
 START_TEST(test_ADynArray_mixedWithStruct)
 {
     size_t i;
@@ -2011,10 +2931,11 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     Suite *s;
     TCase *test_case_ADynArray_construct_destruct, *test_case_ADynArray_setGrowStrategy, *test_case_ADynArray_size,
         *test_case_ADynArray_capacity, *test_case_ADynArray_buffer, *test_case_ADynArray_reserve,
-        *test_case_ADynArray_shrinkToFit, *test_case_ADynArray_clear, *test_case_ADynArray_remove,
+        *test_case_ADynArray_shrinkToFit, *test_case_ADynArray_resize, *test_case_ADynArray_clear, *test_case_ADynArray_remove,
         *test_case_ADynArray_insert, *test_case_ADynArray_insertArray, *test_case_ADynArray_insertADynArray,
         *test_case_ADynArray_append, *test_case_ADynArray_appendArray, *test_case_ADynArray_appendADynArray,
-        *test_case_ADynArray_set, *test_case_ADynArray_setRange, *test_case_ADynArray_mixed;
+        *test_case_ADynArray_insertUninitialized,
+        *test_case_ADynArray_set, *test_case_ADynArray_setRange, *test_case_ADynArray_applyEdits, *test_case_ADynArray_mixed;
 
     s = suite_create("ADynArray Test Suite");
 
@@ -2022,12 +2943,23 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_valid);
     tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_withAllocator_valid);
     tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_withAllocator_invalid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_withAllocatorObject_valid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_withAllocatorObject_invalid);
     tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_noMemoryAvailable);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_compact_valid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_compact_invalid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_small_valid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_small_invalid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_aligned_valid);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_aligned_misalignedAllocator);
+    tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_aligned_invalid);
     tcase_add_test(test_case_ADynArray_construct_destruct, test_ADynArray_construct_destruct_nullptr);
     suite_add_tcase(s, test_case_ADynArray_construct_destruct);
 
     test_case_ADynArray_setGrowStrategy = tcase_create("ADynArray Test Case: ADynArray_setGrowStrategy");
     tcase_add_test(test_case_ADynArray_setGrowStrategy, test_ADynArray_setGrowStrategy);
+    tcase_add_test(test_case_ADynArray_setGrowStrategy, test_ADynArray_growStrategyGeneric);
+    tcase_add_test(test_case_ADynArray_setGrowStrategy, test_ADynArray_growStrategyPresets);
     suite_add_tcase(s, test_case_ADynArray_setGrowStrategy);
 
     test_case_ADynArray_size = tcase_create("ADynArray Test Case: ADynArray_size");
@@ -2049,6 +2981,7 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_success_enoughCapacityBufferNotNull);
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_success_enoughCapacityBufferNull);
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_success_notEnoughCapacity);
+    tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_success_reclaimSlack);
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_failure_biggerThanMaxCapacity);
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_failure_noMemoryAvailable);
     tcase_add_test(test_case_ADynArray_reserve, test_ADynArray_reserve_failure_growStrategyNull);
@@ -2064,6 +2997,11 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_shrinkToFit, test_ADynArray_shrinkToFit_failure_nullptr);
     suite_add_tcase(s, test_case_ADynArray_shrinkToFit);
 
+    test_case_ADynArray_resize = tcase_create("ADynArray Test Case: ADynArray_resize");
+    tcase_add_test(test_case_ADynArray_resize, test_ADynArray_resize_zeroFill);
+    tcase_add_test(test_case_ADynArray_resize, test_ADynArray_resize_failure);
+    suite_add_tcase(s, test_case_ADynArray_resize);
+
     test_case_ADynArray_clear = tcase_create("ADynArray Test Case: ADynArray_clear");
     tcase_add_test(test_case_ADynArray_clear, test_ADynArray_clear);
     tcase_add_test(test_case_ADynArray_clear, test_ADynArray_clear_nullptr);
@@ -2074,6 +3012,12 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_remove, test_ADynArray_remove_rangeBeyondBounds);
     tcase_add_test(test_case_ADynArray_remove, test_ADynArray_remove_zeroRange);
     tcase_add_test(test_case_ADynArray_remove, test_ADynArray_remove_indexBeyoundBounds);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_remove_shrinkPolicy);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_swapRemove);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_removeIf);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_markRemoved_lazy);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_markRemoved_indices);
+    tcase_add_test(test_case_ADynArray_remove, test_ADynArray_markRemoved_compactDivisor);
     tcase_add_test(test_case_ADynArray_remove, test_ADynArray_remove_nullptr);
     suite_add_tcase(s, test_case_ADynArray_remove);
 
@@ -2094,6 +3038,7 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_endIndex);
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_beyondEndIndex);
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_bufferExpanded);
+    tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_bufferExpandedSmall);
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_nullptrArray);
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_zeroArraySize);
     tcase_add_test(test_case_ADynArray_insertArray, test_ADynArray_insertArray_success_negativeIndexGetsMaxIndex);
@@ -2139,6 +3084,12 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_appendADynArray, test_ADynArray_appendADynArray_failure_nullptrDestArray);
     suite_add_tcase(s, test_case_ADynArray_appendADynArray);
 
+    test_case_ADynArray_insertUninitialized = tcase_create("ADynArray Test Case: ADynArray_insertUninitialized");
+    tcase_add_test(test_case_ADynArray_insertUninitialized, test_ADynArray_insertUninitialized_valid);
+    tcase_add_test(test_case_ADynArray_insertUninitialized, test_ADynArray_insertUninitialized_invalid);
+    tcase_add_test(test_case_ADynArray_insertUninitialized, test_ADynArray_appendGenerate);
+    suite_add_tcase(s, test_case_ADynArray_insertUninitialized);
+
     test_case_ADynArray_set = tcase_create("ADynArray Test Case: ADynArray_set");
     tcase_add_test(test_case_ADynArray_set, test_ADynArray_set_success_indexInBounds);
     tcase_add_test(test_case_ADynArray_set, test_ADynArray_set_success_indexBeyondSize);
@@ -2153,11 +3104,17 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void)
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_success_indexInBoundsRangeBeyondSize_bufferExpanded);
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_success_indexAndRangeBeyondSize);
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_success_indexAndRangeBeyondSize_bufferExpanded);
+    tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_success_elementSizes);
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_failure_indexInBoundsRangeBeyondSize_bufferExpansionFailed);
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_failure_indexAndRangeBeyondSize_bufferExpansionFailed);
     tcase_add_test(test_case_ADynArray_setRange, test_ADynArray_setRange_failure_nullptr);
     suite_add_tcase(s, test_case_ADynArray_setRange);
 
+    test_case_ADynArray_applyEdits = tcase_create("ADynArray Test Case: ADynArray_applyEdits");
+    tcase_add_test(test_case_ADynArray_applyEdits, test_ADynArray_applyEdits_matchesSingleEdits);
+    tcase_add_test(test_case_ADynArray_applyEdits, test_ADynArray_applyEdits_invalid);
+    suite_add_tcase(s, test_case_ADynArray_applyEdits);
+
     test_case_ADynArray_mixed = tcase_create("ADynArray Test Case: mixed tests");
     tcase_add_test(test_case_ADynArray_mixed, test_ADynArray_mixedWithStruct);
     suite_add_tcase(s, test_case_ADynArray_mixed);
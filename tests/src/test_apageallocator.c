@@ -0,0 +1,124 @@
+#include "../include/ACUtilsTest/acheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <unistd.h>
+#endif
+
+#include "ACUtils/apageallocator.h"
+#include "ACUtils/adynarray.h"
+#include "ACUtils/astring.h"
+
+A_DYNAMIC_ARRAY_DEFINITION(private_ACUtilsTest_APageAllocator_IntArray, int);
+
+static bool private_ACUtilsTest_APageAllocator_isFilled(const char *buffer, size_t size)
+{
+    size_t i;
+    for(i = 0; i < size; ++i) {
+        if(buffer[i] != (char) (i % 127))
+            return false;
+    }
+    return true;
+}
+
+START_TEST(test_APageAllocator_reallocate_small)
+{
+    struct ACUtilsAllocator allocator = APageAllocator_allocator();
+    char *buffer = (char*) allocator.reallocator(allocator.context, nullptr, 100);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(buffer);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocator.usableSize(allocator.context, buffer), 100);
+    memset(buffer, 'a', 100);
+    buffer = (char*) allocator.reallocator(allocator.context, buffer, 1000);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(buffer);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocator.usableSize(allocator.context, buffer), 1000);
+    ACUTILSTEST_ASSERT_INT_EQ(buffer[99], 'a');
+    allocator.deallocator(allocator.context, buffer);
+    allocator.deallocator(allocator.context, nullptr);
+}
+END_TEST
+START_TEST(test_APageAllocator_reallocate_largeKeepsContent)
+{
+    size_t i, size = 1000;
+    char *buffer = (char*) APageAllocator_reallocate(nullptr, nullptr, size);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(buffer);
+    for(i = 0; i < size; ++i)
+        buffer[i] = (char) (i % 127);
+    /* crosses the map threshold and grows the mapping a few times */
+    while(size < 4 * ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD) {
+        size_t newSize = size * 3;
+        buffer = (char*) APageAllocator_reallocate(nullptr, buffer, newSize);
+        ACUTILSTEST_ASSERT_PTR_NONNULL(buffer);
+        ACUTILSTEST_ASSERT(APageAllocator_usableSize(nullptr, buffer) >= newSize);
+        ACUTILSTEST_ASSERT(private_ACUtilsTest_APageAllocator_isFilled(buffer, size));
+        for(i = size; i < newSize; ++i)
+            buffer[i] = (char) (i % 127);
+        size = newSize;
+    }
+#ifdef _SC_PAGESIZE
+    /* mappings (the only allocations which are rounded up) cover whole pages of the real page size, so the usable part
+     * ends at a page boundary */
+    if(APageAllocator_usableSize(nullptr, buffer) != size)
+        ACUTILSTEST_ASSERT_UINT_EQ(((size_t) (buffer + APageAllocator_usableSize(nullptr, buffer))) % (size_t) sysconf(_SC_PAGESIZE), 0);
+#endif
+    /* shrinking keeps the front */
+    buffer = (char*) APageAllocator_reallocate(nullptr, buffer, ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(buffer);
+    ACUTILSTEST_ASSERT(private_ACUtilsTest_APageAllocator_isFilled(buffer, ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD));
+    APageAllocator_deallocate(nullptr, buffer);
+}
+END_TEST
+START_TEST(test_APageAllocator_allocator_withContainers)
+{
+    size_t i;
+    int value;
+    struct ACUtilsAllocator allocator = APageAllocator_allocator();
+    struct private_ACUtilsTest_APageAllocator_IntArray *array;
+    struct AString *str;
+
+    array = ADynArray_constructWithAllocatorObject(struct private_ACUtilsTest_APageAllocator_IntArray, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(array);
+    ADynArray_setReclaimSlack(array, true);
+    for(value = 0; value < 2000000; ++value) {
+        if(!ADynArray_append(array, value))
+            break;
+    }
+    ACUTILSTEST_ASSERT_INT_EQ(value, 2000000);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(array), 2000000);
+    for(i = 0; i < 2000000; ++i) {
+        if(ADynArray_get(array, i) != (int) i)
+            break;
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(i, 2000000);
+    ADynArray_destruct(array);
+
+    str = AString_constructWithAllocatorObject(&allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(str);
+    ACUTILSTEST_ASSERT(AString_reserve(str, 3 * ACUTILS_APAGEALLOCATOR_MAP_THRESHOLD));
+    for(i = 0; i < 1000; ++i)
+        ACUTILSTEST_ASSERT(AString_appendCString(str, "0123456789", 10));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(str), 10000);
+    ACUTILSTEST_ASSERT_INT_EQ(AString_buffer(str)[9999], '9');
+    AString_destruct(str);
+}
+END_TEST
+
+Suite* private_ACUtilsTest_APageAllocator_getTestSuite(void)
+{
+    Suite *s;
+    TCase *test_case_APageAllocator_reallocate, *test_case_APageAllocator_allocator;
+
+    s = suite_create("APageAllocator Test Suite");
+
+    test_case_APageAllocator_reallocate = tcase_create("APageAllocator Test Case: APageAllocator_reallocate");
+    tcase_add_test(test_case_APageAllocator_reallocate, test_APageAllocator_reallocate_small);
+    tcase_add_test(test_case_APageAllocator_reallocate, test_APageAllocator_reallocate_largeKeepsContent);
+    suite_add_tcase(s, test_case_APageAllocator_reallocate);
+
+    test_case_APageAllocator_allocator = tcase_create("APageAllocator Test Case: APageAllocator_allocator");
+    tcase_add_test(test_case_APageAllocator_allocator, test_APageAllocator_allocator_withContainers);
+    suite_add_tcase(s, test_case_APageAllocator_allocator);
+
+    return s;
+}
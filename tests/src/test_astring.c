@@ -44,9 +44,51 @@ struct AString
     size_t size;
     size_t capacity;
     char *buffer;
+    struct ACUtilsAllocator allocator;
+    unsigned int flags;
+    ACUtilsGrowStrategy growStrategy;
 };
 #endif
 
+struct private_ACUtilsTest_AString_AllocatorContext
+{
+    size_t reallocCount;
+    size_t freeCount;
+};
+static void* private_ACUtilsTest_AString_contextRealloc(void *context, void *ptr, size_t size)
+{
+    void *tmp = realloc(ptr, size);
+    if(tmp != nullptr)
+        ++((struct private_ACUtilsTest_AString_AllocatorContext*) context)->reallocCount;
+    return tmp;
+}
+static void private_ACUtilsTest_AString_contextFree(void *context, void *ptr)
+{
+    if(ptr != nullptr)
+        ++((struct private_ACUtilsTest_AString_AllocatorContext*) context)->freeCount;
+    free(ptr);
+}
+
+/* hands out allocations rounded up to 32 bytes and reports the rounded size as usable */
+static size_t private_ACUtilsTest_AString_slackLastSize = 0;
+static void* private_ACUtilsTest_AString_slackRealloc(void *context, void *ptr, size_t size)
+{
+    (void) context; /* suppress unused warning */
+    private_ACUtilsTest_AString_slackLastSize = (size + 31) / 32 * 32;
+    return realloc(ptr, private_ACUtilsTest_AString_slackLastSize);
+}
+static void private_ACUtilsTest_AString_slackFree(void *context, void *ptr)
+{
+    (void) context; /* suppress unused warning */
+    free(ptr);
+}
+static size_t private_ACUtilsTest_AString_slackUsableSize(void *context, void *ptr)
+{
+    (void) context; /* suppress unused warning */
+    (void) ptr;
+    return private_ACUtilsTest_AString_slackLastSize;
+}
+
 static struct AString private_ACUtilsTest_AString_constructTestString(const char *initBuffer, size_t capacity)
 {
     bool tmp = private_ACUtilsTest_AString_reallocFail;
@@ -220,6 +262,247 @@ START_TEST(test_AString_construct_destruct_withCapacityAndAllocator_noMemoryAvai
     ACUTILSTEST_ASTRING_CHECK_REALLOC(private_ACUtilsTest_AString_freeCount);
 }
 END_TEST
+START_TEST(test_AString_construct_destruct_withAllocatorObject_valid)
+{
+    struct AString *string, *cloned;
+    struct ASplittedString *splitted;
+    struct private_ACUtilsTest_AString_AllocatorContext context = {0, 0};
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_AString_contextRealloc, private_ACUtilsTest_AString_contextFree};
+    allocator.context = &context;
+    string = AString_constructFromCStringWithAllocatorObject("a;b;c", 5, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASSERT_PTR_NULL(string->reallocator);
+    ACUTILSTEST_ASSERT_PTR_NULL(string->deallocator);
+    ACUTILSTEST_ASSERT_PTR_EQ(string->allocator.context, &context);
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "a;b;c", 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 2);
+    cloned = AString_clone(string);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(cloned);
+    ACUTILSTEST_ASSERT_PTR_EQ(cloned->allocator.context, &context);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 4);
+    splitted = AString_split(string, ';', false);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(splitted);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(splitted), 3);
+    ACUTILSTEST_ASSERT_PTR_EQ(ADynArray_allocator(splitted), &splitted->allocator);
+    ACUTILSTEST_ASSERT_PTR_EQ(splitted->allocator.context, &context);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 12);
+    AString_freeSplitted(splitted);
+    AString_destruct(cloned);
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, context.freeCount);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_withAllocatorObject_invalid)
+{
+    struct private_ACUtilsTest_AString_AllocatorContext context = {0, 0};
+    struct ACUtilsAllocator allocator = {nullptr, private_ACUtilsTest_AString_contextFree};
+    allocator.context = &context;
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructWithAllocatorObject(&allocator));
+    allocator.reallocator = private_ACUtilsTest_AString_contextRealloc;
+    allocator.deallocator = nullptr;
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructFromCStringWithAllocatorObject("xyz", 3, &allocator));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructWithCapacityAndAllocatorObject(666, nullptr));
+    ACUTILSTEST_ASSERT_UINT_EQ(context.reallocCount, 0);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_compact_valid)
+{
+    struct AString *string;
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructCompactWithCapacityAndAllocator(10, private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "", 10);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "0123456789", 10));
+    ACUTILSTEST_ASSERT(AString_shrinkToFit(string));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "0123456789", 10);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT(AString_append(string, 'x'));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "0123456789x", 16);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(2);
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 2);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructCompactWithCapacityAndAllocator(0, private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "", 8);
+    AString_destruct(string);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 1);
+    string = AString_constructCompactFromCString("key", 3);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASSERT(AString_equalsCString(string, "key"));
+    AString_destruct(string);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_compact_invalid)
+{
+    struct AString *string;
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_AString_contextRealloc, nullptr};
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructCompactWithCapacityAndAllocator(8, nullptr, private_ACUtilsTest_AString_free));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructCompactWithCapacityAndAllocator(8, private_ACUtilsTest_AString_realloc, nullptr));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructCompactWithCapacityAndAllocatorObject(8, &allocator));
+    private_ACUtilsTest_AString_setReallocFail(true, 0);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructCompactWithCapacityAndAllocator(8, private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASSERT_PTR_NULL(string);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(0);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 0);
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_small_valid)
+{
+    struct AString *string;
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructSmallWithAllocator(private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "", 23);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "0123456789012345678901", 22));
+    ACUTILSTEST_ASSERT(AString_append(string, '2'));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "01234567890123456789012", 23);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT(AString_append(string, '3'));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "012345678901234567890123", 32);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(2);
+    AString_remove(string, 3, 10);
+    ACUTILSTEST_ASSERT(AString_shrinkToFit(string));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "01234567890123", 23);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 1);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "0123456789", 10));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(*string, "012345678901230123456789", 32);
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_reallocCount, private_ACUtilsTest_AString_freeCount);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructSmallWithAllocator(private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    AString_destruct(string);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 1);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_small_sameBehaviour)
+{
+    size_t i;
+    struct AString *strings[2], *tmp[2];
+    struct ASplittedString *splitted;
+    strings[0] = AString_constructFromCString("  key=value  ", 13);
+    strings[1] = AString_constructSmallFromCString("  key=value  ", 13);
+    for(i = 0; i < 2; ++i) {
+        AString_trim(strings[i], ' ');
+        AString_insertCString(strings[i], 3, "name", 4);
+        AString_replace(strings[i], '=', ':', 0);
+        AString_replaceCString(strings[i], "value", 5, "a much longer text than before", 30, 0);
+        AString_setRange(strings[i], 0, 2, 'K');
+        AString_remove(strings[i], 10, 5);
+        AString_shrinkToFit(strings[i]);
+    }
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(strings[0]), AString_buffer(strings[1]));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(strings[0]), AString_size(strings[1]));
+    ACUTILSTEST_ASSERT_INT_EQ(AString_compare(strings[0], strings[1]), 0);
+    for(i = 0; i < 2; ++i) {
+        tmp[i] = AString_clone(strings[i]);
+        AString_destruct(strings[i]);
+        strings[i] = AString_substring(tmp[i], 3, 8);
+        AString_destruct(tmp[i]);
+    }
+    ACUTILSTEST_ASSERT(AString_equals(strings[0], strings[1]));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(strings[1]), 23);
+    splitted = AString_split(strings[1], ':', false);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(splitted), 2);
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(ADynArray_get(splitted, 0)), "name");
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(ADynArray_get(splitted, 0)), 23);
+    AString_freeSplitted(splitted);
+    AString_destruct(strings[0]);
+    AString_destruct(strings[1]);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_small_invalid)
+{
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_AString_contextRealloc, nullptr};
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructSmallWithAllocator(nullptr, private_ACUtilsTest_AString_free));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructSmallWithAllocator(private_ACUtilsTest_AString_realloc, nullptr));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructSmallWithAllocatorObject(&allocator));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructSmallFromCStringWithAllocatorObject("xyz", 3, nullptr));
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_inBuffer_valid)
+{
+    char storage[ACUTILS_ASTRING_STRUCT_STORAGE_SIZE + 16], longText[200];
+    struct AString *string;
+    memset(longText, 'x', sizeof(longText));
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructInBufferWithAllocator(storage, sizeof(storage), private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASSERT((char*) string >= storage && (char*) (string + 1) <= storage + sizeof(storage));
+    ACUTILSTEST_ASSERT_UINT_GE(AString_capacity(string), 16);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "0123456789abcdef", 16));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "0123456789abcdef");
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(0);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, longText, sizeof(longText)));
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    AString_remove(string, 16, -1);
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "0123456789abcdef");
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 1);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructInBuffer(storage + 1, sizeof(storage) - 1);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "key", 3));
+    ACUTILSTEST_ASSERT(AString_shrinkToFit(string));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "key");
+    AString_destruct(string);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_literal_valid)
+{
+    char storage[ACUTILS_ASTRING_STRUCT_STORAGE_SIZE];
+    static const char literal[] = "key=value";
+    struct AString *string, *other;
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructFromLiteralWithAllocator(storage, sizeof(storage), literal, 9, private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(string);
+    ACUTILSTEST_ASSERT_PTR_EQ(AString_buffer(string), literal);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(string), 9);
+    other = AString_constructFromCString("key=value", 9);
+    ACUTILSTEST_ASSERT(AString_equals(string, other));
+    AString_destruct(other);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(0);
+    AString_replace(string, '=', ':', 0);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(1);
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "key:value");
+    ACUTILSTEST_ASSERT_STR_EQ(literal, "key=value");
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "s", 1));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "key:values");
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_freeCount, 1);
+    private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
+    string = AString_constructFromLiteralWithAllocator(storage, sizeof(storage), literal, 9, private_ACUtilsTest_AString_realloc, private_ACUtilsTest_AString_free);
+    private_ACUtilsTest_AString_setReallocFail(true, 0);
+    AString_clear(string);
+    ACUTILSTEST_ASSERT(!AString_set(string, 0, 'K'));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "key=value");
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    AString_trimFront(string, 'k');
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "ey=value");
+    ACUTILSTEST_ASSERT_STR_EQ(literal, "key=value");
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AString_reallocCount, private_ACUtilsTest_AString_freeCount);
+}
+END_TEST
+START_TEST(test_AString_construct_destruct_inBuffer_invalid)
+{
+    char storage[ACUTILS_ASTRING_STRUCT_STORAGE_SIZE];
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructInBuffer(nullptr, sizeof(storage)));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructInBuffer(storage, sizeof(struct AString) - 1));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructInBufferWithAllocator(storage, sizeof(storage), nullptr, free));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructFromLiteral(storage, sizeof(storage), nullptr, 0));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructFromLiteral(storage, sizeof(storage), "key=value", 3));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_constructFromLiteral(storage, 8, "key", 3));
+}
+END_TEST
 START_TEST(test_AString_construct_destruct_nullptr)
 {
     private_ACUtilsTest_AString_reallocCount = private_ACUtilsTest_AString_freeCount = 0;
@@ -260,6 +543,70 @@ START_TEST(test_AString_deallocator_nullptr)
 }
 
 
+START_TEST(test_AString_allocator_valid)
+{
+    struct AString string0 = {realloc, free};
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_allocator(&string0));
+    struct AString string1 = {nullptr, nullptr};
+    string1.allocator.reallocator = private_ACUtilsTest_AString_contextRealloc;
+    string1.allocator.deallocator = private_ACUtilsTest_AString_contextFree;
+    ACUTILSTEST_ASSERT_PTR_EQ(AString_allocator(&string1), &string1.allocator);
+}
+START_TEST(test_AString_allocator_nullptr)
+{
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_allocator(nullptr));
+}
+
+START_TEST(test_AString_setGrowStrategy_valid)
+{
+    struct AString *string, *cloned;
+    string = AString_construct();
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_growStrategy(string));
+    AString_setGrowStrategy(string, ADynArray_growStrategyExact);
+    ACUTILSTEST_ASSERT_PTR_EQ(AString_growStrategy(string), ADynArray_growStrategyExact);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "012345678", 9));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), 9);
+    ACUTILSTEST_ASSERT(AString_append(string, '9'));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), 10);
+    cloned = AString_substring(string, 0, 3);
+    ACUTILSTEST_ASSERT_PTR_EQ(AString_growStrategy(cloned), ADynArray_growStrategyExact);
+    AString_destruct(cloned);
+    AString_setGrowStrategy(string, ADynArray_growStrategyLinearChunk);
+    ACUTILSTEST_ASSERT(AString_append(string, 'a'));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE);
+    AString_setGrowStrategy(string, nullptr);
+    ACUTILSTEST_ASSERT(AString_reserve(string, ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE + 1));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), ACUTILS_ADYNARRAY_LINEAR_CHUNK_SIZE + 1 + 1024);
+    AString_destruct(string);
+}
+END_TEST
+static size_t private_ACUtilsTest_AString_growStrategyMax(size_t requiredSize, size_t typeSize)
+{
+    (void) requiredSize; /* suppress unused warning */
+    (void) typeSize;
+    return (size_t) -1;
+}
+START_TEST(test_AString_setGrowStrategy_maxCapacity)
+{
+    struct AString *string = AString_constructFromCString("abc", 3);
+    AString_setGrowStrategy(string, private_ACUtilsTest_AString_growStrategyMax);
+    ACUTILSTEST_ASSERT(!AString_reserve(string, 100));
+    ACUTILSTEST_ASSERT(!AString_appendCString(string, "0123456789", 10));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "abc");
+    AString_setGrowStrategy(string, nullptr);
+    ACUTILSTEST_ASSERT(AString_reserve(string, 100));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "abc");
+    AString_destruct(string);
+}
+END_TEST
+START_TEST(test_AString_setGrowStrategy_nullptr)
+{
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_growStrategy(nullptr));
+    AString_setGrowStrategy(nullptr, ADynArray_growStrategyExact);
+}
+END_TEST
+
+
 START_TEST(test_AString_size_valid)
 {
     struct AString string = {nullptr, nullptr};
@@ -343,6 +690,27 @@ START_TEST(test_AString_reserve_success_notEnoughCapacity_overMaxAlloc)
     private_ACUtilsTest_AString_destructTestString(string);
 }
 END_TEST
+START_TEST(test_AString_reserve_success_reclaimSlack)
+{
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_AString_slackRealloc, private_ACUtilsTest_AString_slackFree,
+                                         nullptr, private_ACUtilsTest_AString_slackUsableSize};
+    struct AString *string = AString_constructWithAllocatorObject(&allocator);
+    ACUTILSTEST_ASSERT(AString_reserve(string, 9));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), 16);
+    AString_setReclaimSlack(string, true);
+    ACUTILSTEST_ASSERT(AString_reserve(string, 17));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), 63);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "0123456789012345678901234567890123456789012345678901234567890", 61));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_capacity(string), 63);
+    AString_destruct(string);
+    string = AString_construct();
+    AString_setReclaimSlack(string, true);
+    ACUTILSTEST_ASSERT(AString_reserve(string, 100));
+    ACUTILSTEST_ASSERT_UINT_GE(AString_capacity(string), 128);
+    AString_destruct(string);
+    AString_setReclaimSlack(nullptr, true);
+}
+END_TEST
 START_TEST(test_AString_reserve_failure_noMemoryAvailable)
 {
     struct AString string = private_ACUtilsTest_AString_constructTestString("01234", 8);
@@ -761,6 +1129,23 @@ START_TEST(test_AString_insertArray_success_bufferExpanded)
     private_ACUtilsTest_AString_destructTestString(string);
 }
 END_TEST
+START_TEST(test_AString_insertArray_success_bufferExpandedFromOwnBuffer)
+{
+    char literalStorage[ACUTILS_ASTRING_STRUCT_STORAGE_SIZE];
+    struct AString *string = AString_constructFromCString("0123456789", 10);
+    ACUTILSTEST_ASSERT(AString_shrinkToFit(string));
+    ACUTILSTEST_ASSERT(AString_insertCString(string, 5, AString_buffer(string), 10));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "01234012345678956789");
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(string), 20);
+    AString_destruct(string);
+    string = AString_constructFromLiteral(literalStorage, sizeof(literalStorage), "0189", 4);
+    ACUTILSTEST_ASSERT(AString_insertCString(string, 2, "234567", 6));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "0123456789");
+    ACUTILSTEST_ASSERT(AString_insert(string, 0, '-'));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "-0123456789");
+    AString_destruct(string);
+}
+END_TEST
 START_TEST(test_AString_insertArray_success_nullptrArray)
 {
     struct AString string = private_ACUtilsTest_AString_constructTestString("01234567", 8);
@@ -1954,6 +2339,42 @@ START_TEST(test_AString_replaceCString_success_zeroLengthRep)
     private_ACUtilsTest_AString_destructTestString(string);
 }
 END_TEST
+START_TEST(test_AString_replaceCString_success_partialMatches)
+{
+    struct AString string = private_ACUtilsTest_AString_constructTestString("aabxab", 8);
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    ACUTILSTEST_ASSERT(AString_replaceCString(&string, "ab", 2, "c", 1, 0));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(string, "acxc", 8);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(0);
+    private_ACUtilsTest_AString_destructTestString(string);
+}
+END_TEST
+START_TEST(test_AString_replaceCString_success_repContainsOld)
+{
+    struct AString string = private_ACUtilsTest_AString_constructTestString("aba", 8);
+    private_ACUtilsTest_AString_setReallocFail(false, 0);
+    ACUTILSTEST_ASSERT(AString_replaceCString(&string, "a", 1, "aa", 2, 0));
+    ACUTILSTEST_ASTRING_CHECK_ASTRING(string, "aabaa", 8);
+    ACUTILSTEST_ASTRING_CHECK_REALLOC(0);
+    private_ACUtilsTest_AString_destructTestString(string);
+}
+END_TEST
+START_TEST(test_AString_replaceCString_success_manyOccurrences)
+{
+    size_t i;
+    struct AString *string = AString_construct();
+    for(i = 0; i < 10000; ++i)
+        ACUTILSTEST_ASSERT(AString_appendCString(string, "line\n", 5));
+    ACUTILSTEST_ASSERT(AString_replaceCString(string, "\n", 1, "\r\n", 2, 0));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(string), 60000);
+    for(i = 0; i < 10000 && memcmp(AString_buffer(string) + i * 6, "line\r\n", 6) == 0; ++i);
+    ACUTILSTEST_ASSERT_UINT_EQ(i, 10000);
+    ACUTILSTEST_ASSERT(AString_replaceCString(string, "ne\r", 3, "", 0, 9999));
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(string), 30003);
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string) + 29990, "\nli\nli\nline\r\n");
+    AString_destruct(string);
+}
+END_TEST
 START_TEST(test_AString_replaceCString_failure_nullptrOldArray)
 {
     struct AString string = private_ACUtilsTest_AString_constructTestString("xy0xy1xy", 8);
@@ -2154,6 +2575,35 @@ START_TEST(test_AString_replaceAString_failure_nullptr)
 END_TEST
 
 
+START_TEST(test_AString_applyEdits_valid)
+{
+    char literalStorage[ACUTILS_ASTRING_STRUCT_STORAGE_SIZE];
+    struct ACUtilsEdit edits[3] = {{0, 3, "The", 3}, {4, 5, "slow", 4}, {21, 0, " very", 5}};
+    struct AString *string = AString_constructFromCString("the quick fox is fast", 21);
+    ACUTILSTEST_ASSERT(AString_applyEdits(string, edits, 3));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "The slow fox is fast very");
+    edits[0].index = 0;
+    edits[0].removeCount = 4;
+    edits[0].insertCount = 0;
+    ACUTILSTEST_ASSERT(AString_applyEdits(string, edits, 1));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "slow fox is fast very");
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_size(string), 21);
+    edits[1].index = 23;
+    ACUTILSTEST_ASSERT(!AString_applyEdits(string, edits + 1, 1));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "slow fox is fast very");
+    AString_destruct(string);
+    string = AString_constructFromLiteral(literalStorage, sizeof(literalStorage), "abc", 3);
+    ACUTILSTEST_ASSERT(AString_applyEdits(string, nullptr, 0));
+    edits[0].index = 1;
+    edits[0].removeCount = 1;
+    edits[0].insertData = "B";
+    edits[0].insertCount = 1;
+    ACUTILSTEST_ASSERT(AString_applyEdits(string, edits, 1));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "aBc");
+    AString_destruct(string);
+    ACUTILSTEST_ASSERT(!AString_applyEdits(nullptr, edits, 1));
+}
+END_TEST
 START_TEST(test_AString_equals_valid)
 {
     struct AString string1 = private_ACUtilsTest_AString_constructTestString("012345", 8);
@@ -2393,6 +2843,118 @@ START_TEST(test_AString_compareCString_nullptr)
 END_TEST
 
 
+/* returns the index of the first match of needle at or behind index by comparing at every position */
+static size_t private_ACUtilsTest_AString_naiveFind(const char *haystack, size_t size, size_t index, const char *needle, size_t len)
+{
+    for(; index + len <= size; ++index) {
+        if(memcmp(haystack + index, needle, len) == 0)
+            return index;
+    }
+    return ACUTILS_ASTRING_NOT_FOUND;
+}
+static size_t private_ACUtilsTest_AString_naiveRFind(const char *haystack, size_t size, size_t index, const char *needle, size_t len)
+{
+    if(len > size)
+        return ACUTILS_ASTRING_NOT_FOUND;
+    for(index = (index < size - len) ? index : size - len; index + 1 > 0; --index) {
+        if(memcmp(haystack + index, needle, len) == 0)
+            return index;
+    }
+    return ACUTILS_ASTRING_NOT_FOUND;
+}
+START_TEST(test_AString_find_valid)
+{
+    size_t i, len, index;
+    struct AString *needle = AString_constructFromCString("fox", 3);
+    struct AString *string = AString_constructFromCString("the quick fox jumps over the lazy fox", 37);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_find(string, 0, needle), 10);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_find(string, 11, needle), 34);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_find(string, 35, needle), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 0, "the", 3), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 1, "the", 3), 25);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 0, "fax", 3), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 5, "", 0), 5);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 38, "", 0), ACUTILS_ASTRING_NOT_FOUND);
+    AString_destruct(string);
+    /* a haystack with few distinct chars has many partial matches, long needles are searched with Horspool */
+    string = AString_construct();
+    srand(7);
+    for(i = 0; i < 20000; ++i)
+        ACUTILSTEST_ASSERT(AString_append(string, (char) ('a' + rand() % 3)));
+    for(len = 1; len < 40; len += 3) {
+        for(index = 0; index < 20000; index += 997) {
+            const char *buffer = AString_buffer(string);
+            size_t expected = private_ACUtilsTest_AString_naiveFind(buffer, 20000, index, buffer + 19000 - len, len);
+            ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, index, buffer + 19000 - len, len), expected);
+        }
+    }
+    AString_destruct(string);
+    AString_destruct(needle);
+}
+END_TEST
+START_TEST(test_AString_rfind_valid)
+{
+    size_t i, len, index;
+    struct AString *needle = AString_constructFromCString("fox", 3);
+    struct AString *string = AString_constructFromCString("the quick fox jumps over the lazy fox", 37);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfind(string, ACUTILS_ASTRING_NOT_FOUND, needle), 34);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfind(string, 33, needle), 10);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfind(string, 9, needle), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, 100, "the", 3), 25);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, 24, "the", 3), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, 100, "", 0), 37);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, 100, "the quick fox jumps over the lazy fox!", 38), ACUTILS_ASTRING_NOT_FOUND);
+    AString_destruct(string);
+    /* the same haystack as for find, long needles are searched with Horspool from the back */
+    string = AString_construct();
+    srand(7);
+    for(i = 0; i < 20000; ++i)
+        ACUTILSTEST_ASSERT(AString_append(string, (char) ('a' + rand() % 3)));
+    for(len = 1; len < 40; len += 3) {
+        for(index = 0; index < 20000; index += 997) {
+            const char *buffer = AString_buffer(string);
+            size_t expected = private_ACUtilsTest_AString_naiveRFind(buffer, 20000, index, buffer + 1000, len);
+            ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, index, buffer + 1000, len), expected);
+        }
+    }
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfindCString(string, 0, AString_buffer(string), 20), 0);
+    AString_destruct(string);
+    AString_destruct(needle);
+}
+END_TEST
+START_TEST(test_AString_findAll_valid)
+{
+    struct AStringOffsets *offsets;
+    struct AString *needle = AString_constructFromCString("aa", 2);
+    struct AString *string = AString_constructFromCString("aaaxaa", 6);
+    offsets = AString_findAll(string, needle);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(offsets);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(offsets), 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(offsets, 0), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(offsets, 1), 4);
+    ADynArray_destruct(offsets);
+    offsets = AString_findAllCString(string, "b", 1);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(offsets);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(offsets), 0);
+    ADynArray_destruct(offsets);
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_findAllCString(string, "", 0));
+    AString_destruct(string);
+    AString_destruct(needle);
+}
+END_TEST
+START_TEST(test_AString_find_nullptr)
+{
+    struct AString *string = AString_constructFromCString("abc", 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_find(nullptr, 0, string), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_find(string, 0, nullptr), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_findCString(string, 0, nullptr, 0), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfind(nullptr, 0, string), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_UINT_EQ(AString_rfind(string, 0, nullptr), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_findAll(nullptr, string));
+    ACUTILSTEST_ASSERT_PTR_NULL(AString_findAll(string, nullptr));
+    AString_destruct(string);
+}
+END_TEST
 START_TEST(test_AString_clone_valid)
 {
     struct AString string = private_ACUtilsTest_AString_constructTestString("01234567", 666);
@@ -2663,6 +3225,7 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
 {
     Suite *s;
     TCase *test_case_AString_construct_destruct, *test_case_AString_reallocator, *test_case_AString_deallocator,
+          *test_case_AString_allocator, *test_case_AString_setGrowStrategy,
           *test_case_AString_size, *test_case_AString_capacity, *test_case_AString_buffer, *test_case_AString_reserve,
           *test_case_AString_shrinkToFit, *test_case_AString_clear, *test_case_AString_remove, *test_case_AString_trim,
           *test_case_AString_trimFront, *test_case_AString_trimBack, *test_case_AString_insert,
@@ -2670,8 +3233,9 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
           *test_case_AString_appendCString, *test_case_AString_appendAString, *test_case_AString_get,
           *test_case_AString_set, *test_case_AString_setRange, *test_case_AString_replaceRange,
           *test_case_AString_replaceRangeCString, *test_case_AString_replaceRangeAString, *test_case_AString_replace,
-          *test_case_AString_replaceCString, *test_case_AString_replaceAString, *test_case_AString_equals,
+          *test_case_AString_replaceCString, *test_case_AString_replaceAString, *test_case_AString_applyEdits, *test_case_AString_equals,
           *test_case_AString_equalsCString, *test_case_AString_compare, *test_case_AString_compareCString,
+          *test_case_AString_find,
           *test_case_AString_clone, *test_case_AString_substring, *test_case_AString_split;
 
     s = suite_create("AString Test Suite");
@@ -2688,6 +3252,16 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_withAllocator_noMemoryAvailable);
     tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_fromCStringWithAllocator_noMemoryAvailable);
     tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_withCapacityAndAllocator_noMemoryAvailable);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_withAllocatorObject_valid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_withAllocatorObject_invalid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_compact_valid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_compact_invalid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_small_valid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_small_sameBehaviour);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_small_invalid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_inBuffer_valid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_literal_valid);
+    tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_inBuffer_invalid);
     tcase_add_test(test_case_AString_construct_destruct, test_AString_construct_destruct_nullptr);
     suite_add_tcase(s, test_case_AString_construct_destruct);
 
@@ -2701,6 +3275,17 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_deallocator, test_AString_deallocator_nullptr);
     suite_add_tcase(s, test_case_AString_deallocator);
 
+    test_case_AString_allocator = tcase_create("AString Test Case: AString_allocator");
+    tcase_add_test(test_case_AString_allocator, test_AString_allocator_valid);
+    tcase_add_test(test_case_AString_allocator, test_AString_allocator_nullptr);
+    suite_add_tcase(s, test_case_AString_allocator);
+
+    test_case_AString_setGrowStrategy = tcase_create("AString Test Case: AString_setGrowStrategy");
+    tcase_add_test(test_case_AString_setGrowStrategy, test_AString_setGrowStrategy_valid);
+    tcase_add_test(test_case_AString_setGrowStrategy, test_AString_setGrowStrategy_maxCapacity);
+    tcase_add_test(test_case_AString_setGrowStrategy, test_AString_setGrowStrategy_nullptr);
+    suite_add_tcase(s, test_case_AString_setGrowStrategy);
+
     test_case_AString_size = tcase_create("AString Test Case: AString_size");
     tcase_add_test(test_case_AString_size, test_AString_size_valid);
     tcase_add_test(test_case_AString_size, test_AString_size_nullptr);
@@ -2720,6 +3305,7 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_reserve, test_AString_reserve_success_enoughCapacity);
     tcase_add_test(test_case_AString_reserve, test_AString_reserve_success_notEnoughCapacity);
     tcase_add_test(test_case_AString_reserve, test_AString_reserve_success_notEnoughCapacity_overMaxAlloc);
+    tcase_add_test(test_case_AString_reserve, test_AString_reserve_success_reclaimSlack);
     tcase_add_test(test_case_AString_reserve, test_AString_reserve_failure_noMemoryAvailable);
     tcase_add_test(test_case_AString_reserve, test_AString_reserve_failure_nullptr);
     suite_add_tcase(s, test_case_AString_reserve);
@@ -2784,6 +3370,7 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_insertCString, test_AString_insertCString_success_endIndex);
     tcase_add_test(test_case_AString_insertCString, test_AString_insertCString_success_beyondEndIndex);
     tcase_add_test(test_case_AString_insertCString, test_AString_insertArray_success_bufferExpanded);
+    tcase_add_test(test_case_AString_insertCString, test_AString_insertArray_success_bufferExpandedFromOwnBuffer);
     tcase_add_test(test_case_AString_insertCString, test_AString_insertArray_success_nullptrArray);
     tcase_add_test(test_case_AString_insertCString, test_AString_insertArray_success_zeroArraySize);
     tcase_add_test(test_case_AString_insertCString, test_AString_insertArray_failure_bufferExpansionFailed);
@@ -2919,6 +3506,9 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_oldBiggerLengthThanRep);
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_nullptrRepArray);
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_zeroLengthRep);
+    tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_partialMatches);
+    tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_repContainsOld);
+    tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_success_manyOccurrences);
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_failure_nullptrOldArray);
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_failure_oldSmallerLengthThanRep_bufferExpansionFailed);
     tcase_add_test(test_case_AString_replaceCString, test_AString_replaceCString_failure_nullptr);
@@ -2938,6 +3528,10 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_replaceAString, test_AString_replaceAString_failure_nullptr);
     suite_add_tcase(s, test_case_AString_replaceAString);
 
+    test_case_AString_applyEdits = tcase_create("AString Test Case: AString_applyEdits");
+    tcase_add_test(test_case_AString_applyEdits, test_AString_applyEdits_valid);
+    suite_add_tcase(s, test_case_AString_applyEdits);
+
     test_case_AString_equals = tcase_create("AString Test Case: AString_equals");
     tcase_add_test(test_case_AString_equals, test_AString_equals_valid);
     tcase_add_test(test_case_AString_equals, test_AString_equals_nullptr);
@@ -2962,6 +3556,13 @@ ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void)
     tcase_add_test(test_case_AString_compareCString, test_AString_compareCString_nullptr);
     suite_add_tcase(s, test_case_AString_compareCString);
 
+    test_case_AString_find = tcase_create("AString Test Case: AString_find");
+    tcase_add_test(test_case_AString_find, test_AString_find_valid);
+    tcase_add_test(test_case_AString_find, test_AString_rfind_valid);
+    tcase_add_test(test_case_AString_find, test_AString_findAll_valid);
+    tcase_add_test(test_case_AString_find, test_AString_find_nullptr);
+    suite_add_tcase(s, test_case_AString_find);
+
     test_case_AString_substring = tcase_create("AString Test Case: AString_substring");
     tcase_add_test(test_case_AString_substring, test_AString_substring_indexRangeInBounds);
     tcase_add_test(test_case_AString_substring, test_AString_substring_rangeBeyondBounds);
@@ -0,0 +1,238 @@
+#include "../include/ACUtilsTest/acheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ACUtils/astringreplacer.h"
+
+static size_t private_ACUtilsTest_AStringReplacer_allocationCount = 0;
+static bool private_ACUtilsTest_AStringReplacer_reallocFail = false;
+
+static void* private_ACUtilsTest_AStringReplacer_realloc(void *ptr, size_t size) {
+    if(private_ACUtilsTest_AStringReplacer_reallocFail)
+        return nullptr;
+    if(ptr == nullptr)
+        ++private_ACUtilsTest_AStringReplacer_allocationCount;
+    return realloc(ptr, size);
+}
+static void private_ACUtilsTest_AStringReplacer_free(void *ptr) {
+    if(ptr != nullptr)
+        --private_ACUtilsTest_AStringReplacer_allocationCount;
+    free(ptr);
+}
+/* context counts the live allocations */
+static void* private_ACUtilsTest_AStringReplacer_contextRealloc(void *context, void *ptr, size_t size) {
+    if(ptr == nullptr)
+        ++*(size_t*) context;
+    return realloc(ptr, size);
+}
+static void private_ACUtilsTest_AStringReplacer_contextFree(void *context, void *ptr) {
+    if(ptr != nullptr)
+        --*(size_t*) context;
+    free(ptr);
+}
+
+/* finds the leftmost-longest match at or behind index by trying every pattern at every position */
+static bool private_ACUtilsTest_AStringReplacer_naiveFind(const struct AStringReplacement *table, size_t count,
+                                                          const char *text, size_t size, size_t index,
+                                                          struct AStringMatch *match)
+{
+    size_t i;
+    for(; index < size; ++index) {
+        bool found = false;
+        for(i = 0; i < count; ++i) {
+            if(table[i].patternLen <= size - index && memcmp(text + index, table[i].pattern, table[i].patternLen) == 0
+               && (!found || table[i].patternLen > table[match->pattern].patternLen)) {
+                match->index = index;
+                match->pattern = i;
+                found = true;
+            }
+        }
+        if(found)
+            return true;
+    }
+    return false;
+}
+
+START_TEST(test_AStringReplacer_construct_destruct_valid)
+{
+    struct AStringReplacement table[3] = {{"a", 1, "b", 1}, {"abc", 3, nullptr, 0}, {"a", 1, "c", 1}};
+    struct AStringReplacer *replacer;
+    private_ACUtilsTest_AStringReplacer_allocationCount = 0;
+    replacer = AStringReplacer_constructWithAllocator(table, 3, private_ACUtilsTest_AStringReplacer_realloc,
+                                                      private_ACUtilsTest_AStringReplacer_free);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(replacer);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringReplacer_patternCount(replacer), 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AStringReplacer_allocationCount, 1);
+    AStringReplacer_destruct(replacer);
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AStringReplacer_allocationCount, 0);
+    replacer = AStringReplacer_construct(nullptr, 0);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(replacer);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringReplacer_patternCount(replacer), 0);
+    AStringReplacer_destruct(replacer);
+}
+END_TEST
+START_TEST(test_AStringReplacer_construct_destruct_allocatorObject)
+{
+    struct AStringReplacement table[2] = {{"ab", 2, "x", 1}, {"b", 1, "yy", 2}};
+    struct ACUtilsAllocator allocator = {private_ACUtilsTest_AStringReplacer_contextRealloc,
+                                         private_ACUtilsTest_AStringReplacer_contextFree};
+    size_t allocationCount = 0;
+    struct AStringReplacer *replacer;
+    struct AStringMatches *matches;
+    struct AString *string = AString_constructFromCString("abbab", 5);
+    allocator.context = &allocationCount;
+    replacer = AStringReplacer_constructWithAllocatorObject(table, 2, &allocator);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(replacer);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocationCount, 1);
+    matches = AStringReplacer_findAny(replacer, string);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(matches);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(matches), 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocationCount, 3);
+    ADynArray_destruct(matches);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocationCount, 1);
+    ACUTILSTEST_ASSERT(AStringReplacer_apply(replacer, string));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "xyyx");
+    ACUTILSTEST_ASSERT_UINT_EQ(allocationCount, 1);
+    AStringReplacer_destruct(replacer);
+    ACUTILSTEST_ASSERT_UINT_EQ(allocationCount, 0);
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_constructWithAllocatorObject(table, 2, nullptr));
+    allocator.deallocator = nullptr;
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_constructWithAllocatorObject(table, 2, &allocator));
+    AString_destruct(string);
+}
+END_TEST
+START_TEST(test_AStringReplacer_construct_destruct_invalid)
+{
+    struct AStringReplacement table[2] = {{"a", 1, "b", 1}, {"", 0, "c", 1}};
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_construct(table, 2));
+    table[1].pattern = nullptr;
+    table[1].patternLen = 1;
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_construct(table, 2));
+    table[1].pattern = "b";
+    table[1].replacement = nullptr;
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_construct(table, 2));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_construct(nullptr, 1));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_constructWithAllocator(table, 1, nullptr, free));
+    private_ACUtilsTest_AStringReplacer_allocationCount = 0;
+    private_ACUtilsTest_AStringReplacer_reallocFail = true;
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_constructWithAllocator(table, 1, private_ACUtilsTest_AStringReplacer_realloc,
+                                                                       private_ACUtilsTest_AStringReplacer_free));
+    private_ACUtilsTest_AStringReplacer_reallocFail = false;
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AStringReplacer_allocationCount, 0);
+    AStringReplacer_destruct(nullptr);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringReplacer_patternCount(nullptr), 0);
+}
+END_TEST
+
+START_TEST(test_AStringReplacer_findAny_leftmostLongest)
+{
+    struct AStringReplacement table[5] = {{"he", 2, nullptr, 0}, {"she", 3, nullptr, 0}, {"hers", 4, nullptr, 0},
+                                          {"bc", 2, nullptr, 0}, {"abcd", 4, nullptr, 0}};
+    struct AStringReplacer *replacer = AStringReplacer_construct(table, 5);
+    struct AString *string = AString_constructFromCString("ushers abcbcd hehers", 20);
+    struct AStringMatches *matches = AStringReplacer_findAny(replacer, string);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(matches);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_size(matches), 5);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 0).index, 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 0).pattern, 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 1).index, 8);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 1).pattern, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 2).index, 10);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 2).pattern, 3);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 3).index, 14);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 3).pattern, 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 4).index, 16);
+    ACUTILSTEST_ASSERT_UINT_EQ(ADynArray_get(matches, 4).pattern, 2);
+    ADynArray_destruct(matches);
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_findAny(nullptr, string));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringReplacer_findAny(replacer, nullptr));
+    AString_destruct(string);
+    AStringReplacer_destruct(replacer);
+}
+END_TEST
+START_TEST(test_AStringReplacer_find_matchesNaiveSearch)
+{
+    size_t i, j, index;
+    char patterns[8][6];
+    struct AStringReplacement table[8];
+    struct AStringMatch match, expected;
+    struct AStringReplacer *replacer;
+    struct AString *string = AString_construct();
+    srand(11);
+    for(i = 0; i < 8; ++i) {
+        table[i].patternLen = 1 + rand() % 5;
+        for(j = 0; j < table[i].patternLen; ++j)
+            patterns[i][j] = (char) ('a' + rand() % 3);
+        table[i].pattern = patterns[i];
+        table[i].replacement = nullptr;
+        table[i].replacementLen = 0;
+    }
+    for(i = 0; i < 5000; ++i)
+        ACUTILSTEST_ASSERT(AString_append(string, (char) ('a' + rand() % 4)));
+    replacer = AStringReplacer_construct(table, 8);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(replacer);
+    index = 0;
+    while(private_ACUtilsTest_AStringReplacer_naiveFind(table, 8, AString_buffer(string), 5000, index, &expected)) {
+        ACUTILSTEST_ASSERT(AStringReplacer_find(replacer, string, index, &match));
+        ACUTILSTEST_ASSERT_UINT_EQ(match.index, expected.index);
+        ACUTILSTEST_ASSERT_UINT_EQ(table[match.pattern].patternLen, table[expected.pattern].patternLen);
+        index = match.index + table[match.pattern].patternLen;
+    }
+    ACUTILSTEST_ASSERT(!AStringReplacer_find(replacer, string, index, &match));
+    ACUTILSTEST_ASSERT(!AStringReplacer_find(replacer, string, 0, nullptr));
+    AStringReplacer_destruct(replacer);
+    AString_destruct(string);
+}
+END_TEST
+
+START_TEST(test_AStringReplacer_apply_valid)
+{
+    struct AStringReplacement table[4] = {{"&", 1, "&amp;", 5}, {"<", 1, "&lt;", 4}, {">", 1, "&gt;", 4},
+                                          {"\"", 1, "&quot;", 6}};
+    struct AStringReplacement swapTable[2] = {{"ab", 2, "b", 1}, {"b", 1, "ab", 2}};
+    struct AStringReplacer *replacer = AStringReplacer_construct(table, 4);
+    struct AString *string = AString_constructFromCString("<a href=\"x\">&lt;</a>", 20);
+    ACUTILSTEST_ASSERT(AStringReplacer_apply(replacer, string));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "&lt;a href=&quot;x&quot;&gt;&amp;lt;&lt;/a&gt;");
+    AStringReplacer_destruct(replacer);
+    /* replacements are not scanned again, so patterns can be swapped in one pass */
+    replacer = AStringReplacer_construct(swapTable, 2);
+    ACUTILSTEST_ASSERT(AStringReplacer_apply(replacer, string));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "&lt;a href=&quot;x&quot;&gt;&amp;lt;&lt;/a&gt;");
+    AString_clear(string);
+    ACUTILSTEST_ASSERT(AString_appendCString(string, "abbab", 5));
+    ACUTILSTEST_ASSERT(AStringReplacer_apply(replacer, string));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(string), "babb");
+    ACUTILSTEST_ASSERT(!AStringReplacer_apply(replacer, nullptr));
+    ACUTILSTEST_ASSERT(!AStringReplacer_apply(nullptr, string));
+    AString_destruct(string);
+    AStringReplacer_destruct(replacer);
+}
+END_TEST
+
+
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AStringReplacer_getTestSuite(void)
+{
+    Suite *s;
+    TCase *test_case_AStringReplacer_construct_destruct, *test_case_AStringReplacer_find, *test_case_AStringReplacer_apply;
+
+    s = suite_create("AStringReplacer Test Suite");
+
+    test_case_AStringReplacer_construct_destruct = tcase_create("AStringReplacer Test Case: AStringReplacer_construct / AStringReplacer_destruct");
+    tcase_add_test(test_case_AStringReplacer_construct_destruct, test_AStringReplacer_construct_destruct_valid);
+    tcase_add_test(test_case_AStringReplacer_construct_destruct, test_AStringReplacer_construct_destruct_allocatorObject);
+    tcase_add_test(test_case_AStringReplacer_construct_destruct, test_AStringReplacer_construct_destruct_invalid);
+    suite_add_tcase(s, test_case_AStringReplacer_construct_destruct);
+
+    test_case_AStringReplacer_find = tcase_create("AStringReplacer Test Case: AStringReplacer_find / AStringReplacer_findAny");
+    tcase_add_test(test_case_AStringReplacer_find, test_AStringReplacer_findAny_leftmostLongest);
+    tcase_add_test(test_case_AStringReplacer_find, test_AStringReplacer_find_matchesNaiveSearch);
+    suite_add_tcase(s, test_case_AStringReplacer_find);
+
+    test_case_AStringReplacer_apply = tcase_create("AStringReplacer Test Case: AStringReplacer_apply");
+    tcase_add_test(test_case_AStringReplacer_apply, test_AStringReplacer_apply_valid);
+    suite_add_tcase(s, test_case_AStringReplacer_apply);
+
+    return s;
+}
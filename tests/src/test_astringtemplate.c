@@ -0,0 +1,139 @@
+#include "../include/ACUtilsTest/acheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ACUtils/astringtemplate.h"
+
+static size_t private_ACUtilsTest_AStringTemplate_reallocCount = 0;
+
+static void* private_ACUtilsTest_AStringTemplate_realloc(void *ptr, size_t size) {
+    void* tmp = realloc(ptr, size);
+    if(tmp != nullptr)
+        ++private_ACUtilsTest_AStringTemplate_reallocCount;
+    return tmp;
+}
+
+START_TEST(test_AStringTemplate_construct_destruct_valid)
+{
+    struct AString *templateStr = AString_constructFromCString("{greeting}, {name}! {{{name}}} }}", 33);
+    struct AStringTemplate *stringTemplate = AStringTemplate_construct(templateStr);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(stringTemplate);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotCount(stringTemplate), 2);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotIndex(stringTemplate, "greeting", 8), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotIndex(stringTemplate, "name", 4), 1);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotIndex(stringTemplate, "nam", 3), ACUTILS_ASTRING_NOT_FOUND);
+    AStringTemplate_destruct(stringTemplate);
+    stringTemplate = AStringTemplate_constructFromCString("", 0);
+    ACUTILSTEST_ASSERT_PTR_NONNULL(stringTemplate);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotCount(stringTemplate), 0);
+    AStringTemplate_destruct(stringTemplate);
+    AString_destruct(templateStr);
+}
+END_TEST
+START_TEST(test_AStringTemplate_construct_destruct_invalid)
+{
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString("a {name", 7));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString("a {} b", 6));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString("a {x{y} b", 9));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString("a } b", 5));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString("a {x}}", 6));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCString(nullptr, 0));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_constructFromCStringWithAllocator("a", 1, nullptr, free));
+    ACUTILSTEST_ASSERT_PTR_NULL(AStringTemplate_construct(nullptr));
+    AStringTemplate_destruct(nullptr);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotCount(nullptr), 0);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_slotIndex(nullptr, "a", 1), ACUTILS_ASTRING_NOT_FOUND);
+}
+END_TEST
+
+START_TEST(test_AStringTemplate_render_valid)
+{
+    size_t i;
+    struct AStringTemplateValue values[2] = {{"Hello", 5}, {"World", 5}};
+    struct AStringTemplate *stringTemplate = AStringTemplate_constructFromCString("{greeting}, {name}! {{{name}}} }}", 33);
+    struct AString *out = AString_constructWithAllocator(private_ACUtilsTest_AStringTemplate_realloc, free);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_renderedSize(stringTemplate, values), 23);
+    ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, values, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "Hello, World! {World} }");
+    ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, values, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "Hello, World! {World} }Hello, World! {World} }");
+    /* a reused output string is reserved once and then rendered into without allocations */
+    values[0].cstr = "Hi";
+    values[0].len = 2;
+    private_ACUtilsTest_AStringTemplate_reallocCount = 0;
+    for(i = 0; i < 100; ++i) {
+        AString_clear(out);
+        ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, values, out));
+    }
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "Hi, World! {World} }");
+    ACUTILSTEST_ASSERT_UINT_EQ(private_ACUtilsTest_AStringTemplate_reallocCount, 0);
+    values[1].cstr = nullptr;
+    values[1].len = 0;
+    AString_clear(out);
+    ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, values, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "Hi, ! {} }");
+    AString_destruct(out);
+    AStringTemplate_destruct(stringTemplate);
+}
+END_TEST
+START_TEST(test_AStringTemplate_render_valueInOut)
+{
+    struct AStringTemplateValue value;
+    struct AStringTemplate *stringTemplate = AStringTemplate_constructFromCString("{a}-{a}", 7);
+    struct AString *out = AString_constructFromCString("0123456789", 10);
+    ACUTILSTEST_ASSERT(AString_shrinkToFit(out));
+    value.cstr = AString_buffer(out);
+    value.len = AString_size(out);
+    ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, &value, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "01234567890123456789-0123456789");
+    value.cstr = AString_buffer(out) + 20;
+    value.len = 3;
+    ACUTILSTEST_ASSERT(AStringTemplate_render(stringTemplate, &value, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "01234567890123456789-0123456789-01--01");
+    AString_destruct(out);
+    AStringTemplate_destruct(stringTemplate);
+}
+END_TEST
+START_TEST(test_AStringTemplate_render_invalid)
+{
+    struct AStringTemplateValue values[1] = {{nullptr, 3}};
+    struct AStringTemplate *stringTemplate = AStringTemplate_constructFromCString("<{x}>", 5);
+    struct AString *out = AString_constructFromCString("kept", 4);
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_renderedSize(stringTemplate, values), ACUTILS_ASTRING_NOT_FOUND);
+    ACUTILSTEST_ASSERT(!AStringTemplate_render(stringTemplate, values, out));
+    ACUTILSTEST_ASSERT(!AStringTemplate_render(stringTemplate, nullptr, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "kept");
+    values[0].cstr = "x";
+    values[0].len = ((size_t) -1) - 2;
+    ACUTILSTEST_ASSERT_UINT_EQ(AStringTemplate_renderedSize(stringTemplate, values), ACUTILS_ASTRING_NOT_FOUND);
+    values[0].len = 1;
+    ACUTILSTEST_ASSERT(!AStringTemplate_render(stringTemplate, values, nullptr));
+    ACUTILSTEST_ASSERT(!AStringTemplate_render(nullptr, values, out));
+    ACUTILSTEST_ASSERT_STR_EQ(AString_buffer(out), "kept");
+    AString_destruct(out);
+    AStringTemplate_destruct(stringTemplate);
+}
+END_TEST
+
+
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AStringTemplate_getTestSuite(void)
+{
+    Suite *s;
+    TCase *test_case_AStringTemplate_construct_destruct, *test_case_AStringTemplate_render;
+
+    s = suite_create("AStringTemplate Test Suite");
+
+    test_case_AStringTemplate_construct_destruct = tcase_create("AStringTemplate Test Case: AStringTemplate_construct / AStringTemplate_destruct");
+    tcase_add_test(test_case_AStringTemplate_construct_destruct, test_AStringTemplate_construct_destruct_valid);
+    tcase_add_test(test_case_AStringTemplate_construct_destruct, test_AStringTemplate_construct_destruct_invalid);
+    suite_add_tcase(s, test_case_AStringTemplate_construct_destruct);
+
+    test_case_AStringTemplate_render = tcase_create("AStringTemplate Test Case: AStringTemplate_render");
+    tcase_add_test(test_case_AStringTemplate_render, test_AStringTemplate_render_valid);
+    tcase_add_test(test_case_AStringTemplate_render, test_AStringTemplate_render_valueInOut);
+    tcase_add_test(test_case_AStringTemplate_render, test_AStringTemplate_render_invalid);
+    suite_add_tcase(s, test_case_AStringTemplate_render);
+
+    return s;
+}
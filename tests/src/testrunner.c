@@ -11,6 +11,10 @@
 
 ACUTILS_EXTERN_C Suite* private_ACUtilsTest_ADynArray_getTestSuite(void);
 ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AString_getTestSuite(void);
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AArena_getTestSuite(void);
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_APageAllocator_getTestSuite(void);
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AStringReplacer_getTestSuite(void);
+ACUTILS_EXTERN_C Suite* private_ACUtilsTest_AStringTemplate_getTestSuite(void);
 
 int main(void)
 {
@@ -29,5 +33,29 @@ int main(void)
     numberFailed += srunner_ntests_failed(runner);
     srunner_free(runner);
 
+    runner = srunner_create(private_ACUtilsTest_AArena_getTestSuite());
+    srunner_set_fork_status(runner, CK_NOFORK);
+    srunner_run_all(runner, CK_NORMAL);
+    numberFailed += srunner_ntests_failed(runner);
+    srunner_free(runner);
+
+    runner = srunner_create(private_ACUtilsTest_APageAllocator_getTestSuite());
+    srunner_set_fork_status(runner, CK_NOFORK);
+    srunner_run_all(runner, CK_NORMAL);
+    numberFailed += srunner_ntests_failed(runner);
+    srunner_free(runner);
+
+    runner = srunner_create(private_ACUtilsTest_AStringReplacer_getTestSuite());
+    srunner_set_fork_status(runner, CK_NOFORK);
+    srunner_run_all(runner, CK_NORMAL);
+    numberFailed += srunner_ntests_failed(runner);
+    srunner_free(runner);
+
+    runner = srunner_create(private_ACUtilsTest_AStringTemplate_getTestSuite());
+    srunner_set_fork_status(runner, CK_NOFORK);
+    srunner_run_all(runner, CK_NORMAL);
+    numberFailed += srunner_ntests_failed(runner);
+    srunner_free(runner);
+
     return (numberFailed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }